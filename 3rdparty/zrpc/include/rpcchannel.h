@@ -8,10 +8,13 @@
 #include <memory>
 #include <google/protobuf/service.h>
 #include "netaddress.h"
+#include "co/co.h"
 // #include "co/tcp.h"
 
 namespace zrpc_ns {
 
+class TcpClient;
+
 class ZRPC_API ZRpcChannel : public google::protobuf::RpcChannel {
 
 public:
@@ -25,9 +28,27 @@ public:
                     google::protobuf::Message *response,
                     google::protobuf::Closure *done) override;
 
+    // The calls on the long connection are multiplexed: CallMethod can be called from many threads
+    // or coroutines at the same time, each with its own controller, the replies are matched by
+    // msg_req and each call waits until the Timeout() of its controller.
+
+    // pipelined call on the long connection: send the request without waiting for its reply,
+    // then take the reply by recvMethod in any order. Return the msg_req, empty if failed.
+    std::string sendMethod(const google::protobuf::MethodDescriptor *method,
+                           google::protobuf::RpcController *controller,
+                           const google::protobuf::Message *request);
+
+    bool recvMethod(const std::string &msg_req,
+                    google::protobuf::RpcController *controller,
+                    google::protobuf::Message *response);
+
 private:
+    std::shared_ptr<TcpClient> getClient();
+
     NetAddress::ptr m_addr;
     bool isLongConnect { false };
+    co::mutex m_client_mutex;
+    std::shared_ptr<TcpClient> m_client_long { nullptr };
 };
 
 } // namespace zrpc
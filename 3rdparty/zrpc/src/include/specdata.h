@@ -45,6 +45,23 @@ public:
     std::string pb_data;  // business pb data
     int32_t check_num{-1}; // check_num of all package. to check legality of data
     // char end;                        // identify end of a spec data protocal data
+
+    // the decoded pb data is viewed in the read buffer without copy, it is valid until
+    // the buffer is written again. empty pb_view means the data is in pb_data.
+    const char *pb_view{nullptr};
+    uint32_t pb_view_len{0};
+
+    const char *pbData() const { return pb_view ? pb_view : pb_data.data(); }
+    size_t pbSize() const { return pb_view ? pb_view_len : pb_data.size(); }
+
+    // copy the viewed data into pb_data, keep it after the buffer reused.
+    void takePbData() {
+        if (pb_view) {
+            pb_data.assign(pb_view, pb_view_len);
+            pb_view = nullptr;
+            pb_view_len = 0;
+        }
+    }
 };
 
 } // namespace zrpc_ns
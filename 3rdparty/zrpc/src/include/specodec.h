@@ -25,6 +25,14 @@ public:
     void decode(TcpBuffer *buf, AbstractData *data);
 
     const char *encodePbData(SpecDataStruct *data, uint32_t &len);
+
+private:
+    uint32_t packageLength(SpecDataStruct *data);
+
+    void fillPackage(SpecDataStruct *data, char *buf);
+
+    // parse the fields of a complete package, the pb data is viewed in place.
+    bool parsePackage(const char *pkg, uint32_t pk_len, SpecDataStruct *pb_struct);
 };
 
 } // namespace zrpc_ns
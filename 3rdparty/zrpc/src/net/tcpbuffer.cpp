@@ -4,6 +4,7 @@
 
 //#include <unistd.h>
 #include <string.h>
+#include <algorithm>
 #include "tcpbuffer.h"
 #include "co/log.h"
 
@@ -35,54 +36,55 @@ int TcpBuffer::writeIndex() const {
 }
 
 void TcpBuffer::resizeBuffer(int size) {
-    std::vector<char> tmp(size);
+    adjustBuffer();
     int c = std::min(size, readAble());
-    if(m_buffer.size() > m_read_index)
-        memcpy(&tmp[0], &m_buffer[m_read_index], c);
-
-    m_buffer.swap(tmp);
-    m_read_index = 0;
+    m_buffer.resize(static_cast<size_t>(size));
     m_write_index = m_read_index + c;
 }
 
 void TcpBuffer::writeToBuffer(const char *buf, int size) {
-    if (size > writeAble()) {
-        int new_size = (int)(1.5 * (m_write_index + size));
-        resizeBuffer(new_size);
-    }
+    reserve(size);
     memcpy(&m_buffer[m_write_index], buf, size);
     m_write_index += size;
 }
 
+void TcpBuffer::reserve(int size) {
+    if (size <= writeAble())
+        return;
+
+    adjustBuffer();
+    if (size > writeAble()) {
+        // grow by the ratio, the large package is received in linear time
+        int new_size = std::max(m_write_index + size, static_cast<int>(1.5 * m_buffer.size()));
+        m_buffer.resize(static_cast<size_t>(new_size));
+    }
+}
+
+const char *TcpBuffer::peek() const {
+    return m_buffer.data() + m_read_index;
+}
+
+char *TcpBuffer::beginWrite() {
+    return m_buffer.data() + m_write_index;
+}
+
 void TcpBuffer::readFromBuffer(std::vector<char> &re, int size) {
     if (readAble() == 0) {
         DLOG << "read buffer empty!";
         return;
     }
     int read_size = readAble() > size ? size : readAble();
-    std::vector<char> tmp(read_size);
-
-    // std::copy(m_read_index, m_read_index + read_size, tmp);
-    memcpy(&tmp[0], &m_buffer[m_read_index], read_size);
-    re.swap(tmp);
-    m_read_index += read_size;
-    adjustBuffer();
+    re.assign(peek(), peek() + read_size);
+    recycleRead(read_size);
 }
 
 void TcpBuffer::adjustBuffer() {
-    if (m_read_index > static_cast<int>(m_buffer.size() / 3)) {
-
-        std::vector<char> new_buffer(m_buffer.size());
-
-        int count = readAble();
-        // std::copy(&m_buffer[m_read_index], readAble(), &new_buffer);
-        memcpy(&new_buffer[0], &m_buffer[m_read_index], count);
-
-        m_buffer.swap(new_buffer);
-        m_write_index = count;
-        m_read_index = 0;
-        new_buffer.clear();
-    }
+    // move the unread data to the front in place
+    int count = readAble();
+    if (m_read_index > 0 && count > 0)
+        memmove(&m_buffer[0], &m_buffer[m_read_index], static_cast<size_t>(count));
+    m_write_index = count;
+    m_read_index = 0;
 }
 
 int TcpBuffer::getSize() {
@@ -90,19 +92,21 @@ int TcpBuffer::getSize() {
 }
 
 void TcpBuffer::clearBuffer() {
-    m_buffer.clear();
+    // keep the memory for the next package
     m_read_index = 0;
     m_write_index = 0;
 }
 
 void TcpBuffer::recycleRead(int index) {
     int j = m_read_index + index;
-    if (j > (int)m_buffer.size()) {
+    if (j > m_write_index) {
         ELOG << "recycleRead error";
         return;
     }
     m_read_index = j;
-    adjustBuffer();
+    // the data is not moved here, the decoded package may still be viewed
+    if (m_read_index == m_write_index)
+        clearBuffer();
 }
 
 void TcpBuffer::recycleWrite(int index) {
@@ -112,7 +116,6 @@ void TcpBuffer::recycleWrite(int index) {
         return;
     }
     m_write_index = j;
-    adjustBuffer();
 }
 
 std::string TcpBuffer::getBufferString() {
@@ -33,6 +33,15 @@ public:
 
     void writeToBuffer(const char *buf, int size);
 
+    // make sure size bytes can be written after the write index, the unread data may be moved.
+    void reserve(int size);
+
+    // the unread data, it is not moved until the next reserve or write.
+    const char *peek() const;
+
+    // the write position, call recycleWrite after filled.
+    char *beginWrite();
+
     void readFromBuffer(std::vector<char> &re, int size);
 
     void resizeBuffer(int size);
@@ -9,6 +9,8 @@
 #include "netaddress.h"
 #include "tcpclient.h"
 #include "specodec.h"
+#include "errorcode.h"
+#include "co/time.h"
 
 namespace zrpc_ns {
 
@@ -34,6 +36,11 @@ TcpClient::~TcpClient() {
 }
 
 bool TcpClient::tryConnect() {
+    if (this->connected())
+        return true;
+
+    co::mutex_guard r(m_read_mutex);
+    co::mutex_guard w(m_write_mutex);
     if (!this->connected() && !this->connect()) {
         if (callback) {
             fastring ip = m_peer_addr ? m_peer_addr->getIP() : "";
@@ -62,38 +69,161 @@ TcpConnection *TcpClient::getConnection() {
     return m_connection.get();
 }
 
-int TcpClient::sendAndRecvData(const std::string &msg_no, SpecDataStruct::pb_ptr &res) {
+int TcpClient::sendAndRecvData(SpecDataStruct &req, SpecDataStruct::pb_ptr &res, int timeout) {
+    int rt = sendRequest(req);
+    if (rt != 0)
+        return rt;
+
+    return waitReply(req.msg_req, res, timeout);
+}
+
+int TcpClient::sendRequest(SpecDataStruct &req) {
     if (!this->connected()) {
         std::stringstream ss;
         ss << "connect peer addr[" << m_peer_addr->toString()
            << "] error. sys error=" << strerror(errno);
-        m_err_info = ss.str();
+        setErrInfo(ss.str());
         return -1;
     }
 
+    // register before sending, the reply may be read by another waiter at once
+    {
+        co::mutex_guard g(m_call_mutex);
+        m_pending_calls[req.msg_req] = std::make_shared<PendingCall>();
+    }
+
+    // only the writing is serialized, the reader goes on meanwhile
+    co::mutex_guard g(m_write_mutex);
     m_connection->setUpClient();
+    m_codec->encode(m_connection->getOutBuffer(), &req);
+    if (!req.encode_succ) {
+        setErrInfo("encode data error");
+        finishCall(req.msg_req);
+        return ERROR_FAILED_ENCODE;
+    }
     m_connection->output();
+    return 0;
+}
+
+int TcpClient::waitReply(const std::string &msg_no, SpecDataStruct::pb_ptr &res, int timeout) {
+    int64 deadline = co::now::ms() + timeout;
+    call_ptr call;
+    {
+        co::mutex_guard g(m_call_mutex);
+        auto it = m_pending_calls.find(msg_no);
+        if (it == m_pending_calls.end()) {
+            m_err_info = "no request to wait reply";
+            return ERROR_FAILED_GET_REPLY;
+        }
+        call = it->second;
+    }
+
+    while (true) {
+        bool reader = false;
+        {
+            co::mutex_guard g(m_call_mutex);
+            if (call->reply) {
+                res = call->reply;
+                m_pending_calls.erase(msg_no);
+                return 0;
+            }
+            if (!m_reading) {
+                m_reading = true;
+                reader = true;
+            }
+        }
+
+        int64 left = deadline - co::now::ms();
+        if (left <= 0) {
+            co::mutex_guard g(m_call_mutex);
+            if (reader)
+                m_reading = false;
+            m_pending_calls.erase(msg_no);
+            m_err_info = "call rpc timeout";
+            // someone else should read for the rest
+            for (auto &pending : m_pending_calls)
+                pending.second->done.signal();
+            return ERROR_RPC_CALL_TIMEOUT;
+        }
+
+        if (!reader) {
+            // the reader wakes us up after each read round
+            call->done.wait(static_cast<uint32>(left));
+            continue;
+        }
 
-    while (!m_connection->getResPackageData(msg_no, res)) {
-        // DLOG << "redo getResPackageData";
-        m_connection->input();
+        bool ok = readReplies(static_cast<int>(left));
+        {
+            co::mutex_guard g(m_call_mutex);
+            m_reading = false;
+            if (!ok) {
+                m_err_info = "peer close";
+                m_pending_calls.clear();
+            }
+            // let the waiters take their replies, one of them reads next
+            for (auto &pending : m_pending_calls)
+                pending.second->done.signal();
+        }
+        if (!ok) {
+            // FIXME: distory m_connection ?
+            co::mutex_guard r(m_read_mutex);
+            co::mutex_guard w(m_write_mutex);
+            this->stop();
+            return -1;
+        }
+    }
+}
 
+bool TcpClient::readReplies(int timeout) {
+    std::map<std::string, SpecDataStruct::pb_ptr> replies;
+    {
+        // the reader owns the read buffer and the decoding, the requests are sent meanwhile
+        co::mutex_guard g(m_read_mutex);
+        if (m_peer_addr->isSSL()) {
+            // SSL_read and SSL_write must not run at once on one connection, wait for the data
+            // without the write lock and only read it under the lock. the decrypted data is not
+            // kept by the SSL object (no read ahead), so the socket is readable if any is left.
+            co::io_event ev(_tcp_cli->socket(), co::ev_read);
+            if (!ev.wait(static_cast<uint32>(timeout)))
+                return true;
+            co::mutex_guard w(m_write_mutex);
+            m_connection->input();
+        } else {
+            m_connection->input();
+        }
         if (m_connection->getState() == Closed) {
             ELOG << "peer close";
-            goto err_deal;
+            return false;
         }
-
         m_connection->execute();
+        replies = m_connection->takeResPackages();
     }
 
-    m_err_info = "";
-    return 0;
+    co::mutex_guard g(m_call_mutex);
+    for (auto &reply : replies) {
+        auto it = m_pending_calls.find(reply.first);
+        if (it == m_pending_calls.end()) {
+            DLOG << reply.first << "|drop the reply of timeout call";
+            continue;
+        }
+        it->second->reply = reply.second;
+    }
+    return true;
+}
+
+void TcpClient::finishCall(const std::string &msg_no) {
+    co::mutex_guard g(m_call_mutex);
+    m_pending_calls.erase(msg_no);
+}
 
-err_deal:
+void TcpClient::setErrInfo(const std::string &info) {
+    co::mutex_guard g(m_call_mutex);
+    m_err_info = info;
+}
 
-    // FIXME: distory m_connection ?
-    this->stop();
-    return -1;
+std::string TcpClient::getErrInfo() {
+    co::mutex_guard g(m_call_mutex);
+    return m_err_info;
 }
 
 void TcpClient::stop() {
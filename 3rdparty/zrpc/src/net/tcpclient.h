@@ -6,7 +6,9 @@
 #define ZRPC_TCPCLIENT_H
 
 #include <memory>
+#include <map>
 #include <google/protobuf/service.h>
+#include "co/co.h"
 
 #include "netaddress.h"
 #include "tcpconnection.h"
@@ -23,7 +25,15 @@ public:
 
     bool tryConnect();
 
-    int sendAndRecvData(const std::string &msg_no, SpecDataStruct::pb_ptr &res);
+    // The calls are multiplexed on this connection: every request is sent at once and its reply
+    // is matched by msg_req, so many calls can be in flight from different threads or coroutines
+    // and complete out of order. One waiter reads the socket for all, the others wait their reply.
+    int sendRequest(SpecDataStruct &req);
+
+    // wait the reply of the sent request until timeout ms, the late reply is dropped.
+    int waitReply(const std::string &msg_no, SpecDataStruct::pb_ptr &res, int timeout);
+
+    int sendAndRecvData(SpecDataStruct &req, SpecDataStruct::pb_ptr &res, int timeout);
 
     void stop();
 
@@ -37,7 +47,7 @@ public:
 
     void setTryCounts(const int v) { m_try_counts = v; }
 
-    const std::string &getErrInfo() { return m_err_info; }
+    std::string getErrInfo();
 
     NetAddress::ptr getPeerAddr() const { return m_peer_addr; }
 
@@ -61,6 +71,25 @@ private:
 
     bool m_connect_succ{false};
     CallBackFunc callback { nullptr };
+
+    struct PendingCall {
+        co::event done;
+        SpecDataStruct::pb_ptr reply{nullptr};
+    };
+    typedef std::shared_ptr<PendingCall> call_ptr;
+
+    // guard the pending calls, the reader role and the error info
+    co::mutex m_call_mutex;
+    // the reader and the writers lock separately, a read round doesn't hold back the requests.
+    // lock the read one first if both are needed
+    co::mutex m_read_mutex;
+    co::mutex m_write_mutex;
+    std::map<std::string, call_ptr> m_pending_calls;
+    bool m_reading{false};
+
+    bool readReplies(int timeout);
+    void finishCall(const std::string &msg_no);
+    void setErrInfo(const std::string &info);
 };
 
 } // namespace zrpc_ns
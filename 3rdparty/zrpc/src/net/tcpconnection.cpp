@@ -175,11 +175,10 @@ bool TcpConnection::input()
     while (!read_all) {
 
         if (m_read_buffer->writeAble() == 0) {
-            m_read_buffer->resizeBuffer(m_read_buffer->getSize() + PERPKG_MAX_LEN);
+            m_read_buffer->reserve(PERPKG_MAX_LEN);
         }
 
         int read_count = m_read_buffer->writeAble();
-        int write_index = m_read_buffer->writeIndex();
         if (read_count > PERPKG_MAX_LEN) {
             read_count = PERPKG_MAX_LEN;
         }
@@ -187,7 +186,7 @@ bool TcpConnection::input()
         // DLOG << "m_read_buffer size=" << m_read_buffer->getBufferVector().size()
         //      << " rd=" << m_read_buffer->readIndex() << " wd=" << m_read_buffer->writeIndex();
         atomic_store(&_rev_start_time, co::now::ms());
-        int64 rt = read_hook(&(m_read_buffer->m_buffer[static_cast<size_t>(write_index)]), read_count);
+        int64 rt = read_hook(m_read_buffer->beginWrite(), read_count);
         atomic_store(&_rev_start_time, 0);
         if (rt > 0) {
             m_read_buffer->recycleWrite(static_cast<int>(rt));
@@ -244,21 +243,22 @@ void TcpConnection::execute()
         m_codec->decode(m_read_buffer.get(), data.get());
         // DLOG << "parse service_name=" << pb_struct.service_full_name;
         if (!data->decode_succ) {
-            ELOG << "it parse request error";
+            // the rest is not a full package yet, keep it for the next input
             break;
         }
 
         if (m_connection_type == ServerConnection) {
+            // the request is parsed from the read buffer directly
             m_tcp_svr->getDispatcher()->dispatch(data.get(), this);
         } else if (m_connection_type == ClientConnection) {
             std::shared_ptr<SpecDataStruct> tmp = std::dynamic_pointer_cast<SpecDataStruct>(data);
             if (tmp) {
+                // the reply is taken later, copy it out of the read buffer
+                tmp->takePbData();
                 m_reply_datas.insert(std::make_pair(tmp->msg_req, tmp));
             }
         }
     }
-    // clear read buffer after execute has take it
-    m_read_buffer->clearBuffer();
 }
 
 void TcpConnection::output()
@@ -353,6 +353,13 @@ bool TcpConnection::getResPackageData(const std::string &msg_req,
     return false;
 }
 
+std::map<std::string, SpecDataStruct::pb_ptr> TcpConnection::takeResPackages()
+{
+    std::map<std::string, SpecDataStruct::pb_ptr> datas;
+    datas.swap(m_reply_datas);
+    return datas;
+}
+
 fastring TcpConnection::getRemoteIp()
 {
     if (m_connection_type == ServerConnection && m_serv_conn) {
@@ -76,6 +76,9 @@ public:
 
     bool getResPackageData(const std::string &msg_req, SpecDataStruct::pb_ptr &pb_struct);
 
+    // take all the replies which have been read, keyed by msg_req
+    std::map<std::string, SpecDataStruct::pb_ptr> takeResPackages();
+
     fastring getRemoteIp();
 
 public:
@@ -19,7 +19,6 @@
 
 namespace zrpc_ns {
 
-TcpClient::ptr m_clientlong = nullptr;
 ZRpcChannel::ZRpcChannel(NetAddress::ptr addr, const bool isLong)
     : m_addr(addr)
     , isLongConnect (isLong)
@@ -28,8 +27,52 @@ ZRpcChannel::ZRpcChannel(NetAddress::ptr addr, const bool isLong)
 
 ZRpcChannel::~ZRpcChannel()
 {
-    if (m_clientlong && isLongConnect)
-        m_clientlong = nullptr;
+}
+
+// the long connection is shared by all calls of this channel, the short one is for a call.
+TcpClient::ptr ZRpcChannel::getClient()
+{
+    if (!isLongConnect)
+        return std::make_shared<TcpClient>(m_addr);
+
+    co::mutex_guard g(m_client_mutex);
+    if (m_client_long == nullptr)
+        m_client_long = std::make_shared<TcpClient>(m_addr);
+    return m_client_long;
+}
+
+// serialize the request, the client encodes and sends it
+static bool encodeRequest(const google::protobuf::MethodDescriptor *method,
+                          ZRpcController *rpc_controller,
+                          const google::protobuf::Message *request,
+                          SpecDataStruct &pb_struct) {
+    pb_struct.service_full_name = method->full_name();
+    // DLOG << "call service_name = " << pb_struct.service_full_name;
+    if (!request->SerializeToString(&(pb_struct.pb_data))) {
+        ELOG << "serialize send package error";
+        rpc_controller->SetError(ERROR_FAILED_SERIALIZE, "serialize data error");
+        return false;
+    }
+    return true;
+}
+
+static bool decodeResponse(const std::string &msg_req,
+                           const SpecDataStruct::pb_ptr &res_data,
+                           ZRpcController *rpc_controller,
+                           google::protobuf::Message *response) {
+    if (!response->ParseFromString(res_data->pb_data)) {
+        rpc_controller->SetError(ERROR_FAILED_DESERIALIZE,
+                                 "failed to deserialize data from server");
+        ELOG << msg_req << "|failed to deserialize data";
+        return false;
+    }
+    if (res_data->err_code != 0) {
+        ELOG << msg_req << "|server reply error_code=" << res_data->err_code
+             << ", err_info=" << res_data->err_info;
+        rpc_controller->SetError(static_cast<int>(res_data->err_code), res_data->err_info);
+        return false;
+    }
+    return true;
 }
 
 void ZRpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
@@ -44,14 +87,8 @@ void ZRpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
         ELOG << "call failed. falid to dynamic cast ZRpcController";
         return;
     }
-    if (isLongConnect && m_clientlong == nullptr)
-        m_clientlong = std::make_shared<TcpClient>(m_addr);
-
-    TcpClient::ptr m_client = isLongConnect ? m_clientlong : nullptr;
-    if (m_client.get() == nullptr) {        
-        m_client = std::make_shared<TcpClient>(m_addr);
-    }
-
+    TcpClient::ptr m_client = getClient();
+    m_client->setTimeout(rpc_controller->Timeout());
     if (!m_client->tryConnect()) {
         rpc_controller->SetError(ERROR_FAILED_CONNECT, "failed to connect");
         ELOG << "client can not connect to server: " << m_addr.get()->toString();
@@ -60,14 +97,8 @@ void ZRpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
     // rpc_controller->SetLocalAddr(m_client->getLocalAddr());
     // rpc_controller->SetPeerAddr(m_client->getPeerAddr());
 
-    pb_struct.service_full_name = method->full_name();
-    // DLOG << "call service_name = " << pb_struct.service_full_name;
-    if (!request->SerializeToString(&(pb_struct.pb_data))) {
-        ELOG << "serialize send package error";
-        return;
-    }
-
-    if (!rpc_controller->MsgSeq().empty()) {
+    // the replies on the long connection are matched by msg_req, every call needs a new one
+    if (!isLongConnect && !rpc_controller->MsgSeq().empty()) {
         pb_struct.msg_req = rpc_controller->MsgSeq();
     } else {
         pb_struct.msg_req = Util::genMsgNumber();
@@ -75,21 +106,15 @@ void ZRpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
         rpc_controller->SetMsgReq(pb_struct.msg_req);
     }
 
-    AbstractCodeC::ptr m_codec = m_client->getConnection()->getCodec();
-    m_codec->encode(m_client->getConnection()->getOutBuffer(), &pb_struct);
-    if (!pb_struct.encode_succ) {
-        rpc_controller->SetError(ERROR_FAILED_ENCODE, "encode data error");
+    if (!encodeRequest(method, rpc_controller, request, pb_struct))
         return;
-    }
 
     // LOG << "============================================================";
     // LOG << pb_struct.msg_req << "|" << rpc_controller->PeerAddr()->toString()
     //     << "|. Set client send request data:" << request->ShortDebugString();
     // LOG << "============================================================";
-    m_client->setTimeout(rpc_controller->Timeout());
-
     SpecDataStruct::pb_ptr res_data;
-    int rt = m_client->sendAndRecvData(pb_struct.msg_req, res_data);
+    int rt = m_client->sendAndRecvData(pb_struct, res_data, rpc_controller->Timeout());
     if (rt != 0) {
         rpc_controller->SetError(rt, m_client->getErrInfo());
         ELOG << pb_struct.msg_req
@@ -98,18 +123,8 @@ void ZRpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
         return;
     }
 
-    if (!response->ParseFromString(res_data->pb_data)) {
-        rpc_controller->SetError(ERROR_FAILED_DESERIALIZE,
-                                 "failed to deserialize data from server");
-        ELOG << pb_struct.msg_req << "|failed to deserialize data";
-        return;
-    }
-    if (res_data->err_code != 0) {
-        ELOG << pb_struct.msg_req << "|server reply error_code=" << res_data->err_code
-             << ", err_info=" << res_data->err_info;
-        rpc_controller->SetError(static_cast<int>(res_data->err_code), res_data->err_info);
+    if (!decodeResponse(pb_struct.msg_req, res_data, rpc_controller, response))
         return;
-    }
 
     // LOG << "============================================================";
     // LOG << pb_struct.msg_req << "|" << rpc_controller->PeerAddr()->toString()
@@ -123,4 +138,72 @@ void ZRpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
     }
 }
 
+std::string ZRpcChannel::sendMethod(const google::protobuf::MethodDescriptor *method,
+                                    google::protobuf::RpcController *controller,
+                                    const google::protobuf::Message *request) {
+    ZRpcController *rpc_controller = dynamic_cast<ZRpcController *>(controller);
+    if (!rpc_controller) {
+        ELOG << "call failed. falid to dynamic cast ZRpcController";
+        return "";
+    }
+    if (!isLongConnect) {
+        // the reply can only be taken from the same connection
+        rpc_controller->SetError(ERROR_FAILED_CONNECT, "pipelined call needs long connection");
+        return "";
+    }
+    TcpClient::ptr m_client = getClient();
+    m_client->setTimeout(rpc_controller->Timeout());
+    if (!m_client->tryConnect()) {
+        rpc_controller->SetError(ERROR_FAILED_CONNECT, "failed to connect");
+        ELOG << "client can not connect to server: " << m_addr.get()->toString();
+        return "";
+    }
+
+    // every pipelined request has its own msg_req to match the reply
+    SpecDataStruct pb_struct;
+    pb_struct.msg_req = Util::genMsgNumber();
+    if (!encodeRequest(method, rpc_controller, request, pb_struct))
+        return "";
+
+    int rt = m_client->sendRequest(pb_struct);
+    if (rt != 0) {
+        rpc_controller->SetError(rt, m_client->getErrInfo());
+        ELOG << pb_struct.msg_req << "|send rpc occur client error, error_code=" << rt
+             << ", error_info = " << m_client->getErrInfo();
+        return "";
+    }
+    return pb_struct.msg_req;
+}
+
+bool ZRpcChannel::recvMethod(const std::string &msg_req,
+                             google::protobuf::RpcController *controller,
+                             google::protobuf::Message *response) {
+    ZRpcController *rpc_controller = dynamic_cast<ZRpcController *>(controller);
+    if (!rpc_controller) {
+        ELOG << "call failed. falid to dynamic cast ZRpcController";
+        return false;
+    }
+
+    TcpClient::ptr m_client;
+    if (isLongConnect) {
+        co::mutex_guard g(m_client_mutex);
+        m_client = m_client_long;
+    }
+    if (m_client == nullptr) {
+        rpc_controller->SetError(ERROR_FAILED_GET_REPLY, "no connection to get reply");
+        return false;
+    }
+
+    SpecDataStruct::pb_ptr res_data;
+    int rt = m_client->waitReply(msg_req, res_data, rpc_controller->Timeout());
+    if (rt != 0) {
+        rpc_controller->SetError(rt, m_client->getErrInfo());
+        ELOG << msg_req << "|recv rpc occur client error, error_code=" << rt
+             << ", error_info = " << m_client->getErrInfo();
+        return false;
+    }
+
+    return decodeResponse(msg_req, res_data, rpc_controller, response);
+}
+
 } // namespace zrpc_ns
@@ -82,7 +82,7 @@ void ZRpcDispacther::dispatch(AbstractData *data, TcpConnection *conn) {
     google::protobuf::Message *request = service->GetRequestPrototype(method).New();
     // DLOG << reply_pk.msg_req << "|request.name = " << request->GetDescriptor()->full_name();
 
-    if (!request->ParseFromString(tmp->pb_data)) {
+    if (!request->ParseFromArray(tmp->pbData(), static_cast<int>(tmp->pbSize()))) {
         reply_pk.err_code = ERROR_FAILED_SERIALIZE;
         std::stringstream ss;
         ss << "faild to parse request data, request.name:[" << request->GetDescriptor()->full_name()
@@ -225,11 +225,17 @@ struct FileTransResponse {
     int32 id { -1 };
     fastring name;
     int32 result { -1 };
+    uint32 blk_id { 0 };
+    int32 queue { 0 };
+    int32 feature { 0 };
 
     void from_json(const co::Json& _x_) {
         id = (int32)_x_.get("id").as_int64();
         name = _x_.get("name").as_c_str();
         result = (int32)_x_.get("result").as_int64();
+        blk_id = (uint32)_x_.get("blk_id").as_int64();
+        queue = (int32)_x_.get("queue").as_int64();
+        feature = (int32)_x_.get("feature").as_int64();
     }
 
     co::Json as_json() const {
@@ -237,6 +243,9 @@ struct FileTransResponse {
         _x_.add_member("id", id);
         _x_.add_member("name", name);
         _x_.add_member("result", result);
+        _x_.add_member("blk_id", blk_id);
+        _x_.add_member("queue", queue);
+        _x_.add_member("feature", feature);
         return _x_;
     }
 };
@@ -197,6 +197,11 @@ enum JobTransFileOp {
     FILE_COUNTED = 0X0040, // 数据统计完成
 };
 
+// 接收端在TRANSJOB回复中声明的传输特性，旧版本为0
+enum TransFeature {
+    TRANS_FEATURE_BLOCK_FRAME = 0x0001, // 数据块使用二进制帧FS_BLOCK发送
+};
+
 enum CurrentStatus {
     CURRENT_STATUS_DISCONNECT = 0, // 没有连接
     CURRENT_STATUS_TRAN_CONNECT = 1, // 1是文件投送连接
@@ -42,6 +42,7 @@ typedef enum chan_type_t {
     DISAPPLY_SHARE_CONNECT = 1021, // 取消申请共享
     SEARCH_DEVICE_BY_IP = 1022, // 通过ip搜索设备
     DISCOVER_BY_TCP = 1023, // 通过ip搜索的设备，模拟udp包的发送
+    FS_BLOCK = 1024, // 二进制帧的文件数据块，见blockframe.h
 } ChanType;
 
 struct IncomeData {
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef BLOCKFRAME_H
+#define BLOCKFRAME_H
+
+#include "co/def.h"
+
+#include <string.h>
+#include <string>
+
+// The binary frame of FS_BLOCK, sent as the data of ProtoData with an empty msg:
+//   magic u32 | job_id i32 | file_id i32 | flags i32 | blk_id i64 | data_size i64 | length i64 |
+//   name_len u32 | name | payload
+// All numbers are little endian. The (base64) file name is only sent while it changes,
+// the following blocks of the same file carry FRAME_SAME_NAME instead.
+#define FRAME_MAGIC 0x4B424644 // "DFBK"
+#define FRAME_HEADER_SIZE 44
+#define FRAME_SAME_NAME 0xFFFFFFFF
+
+struct BlockFrame {
+    int32 job_id {0};
+    int32 file_id {0};
+    int32 flags {0};
+    int64 blk_id {0};
+    int64 data_size {0}; // same as FSDataBlock, it is the total size in FILE_COUNTED
+    int64 length {0}; // the payload size
+    uint32 name_len {0};
+    const char *name {nullptr}; // point into the decoded frame
+    const char *payload {nullptr};
+
+    // write the header, name and payload into one buffer, the payload is copied only once.
+    std::string encode(const char *data) const
+    {
+        size_t namesize = name_len == FRAME_SAME_NAME ? 0 : name_len;
+        std::string frame;
+        frame.resize(FRAME_HEADER_SIZE + namesize + static_cast<size_t>(length));
+        char *p = &frame[0];
+        p = put(p, FRAME_MAGIC, 4);
+        p = put(p, static_cast<uint32>(job_id), 4);
+        p = put(p, static_cast<uint32>(file_id), 4);
+        p = put(p, static_cast<uint32>(flags), 4);
+        p = put(p, static_cast<uint64>(blk_id), 8);
+        p = put(p, static_cast<uint64>(data_size), 8);
+        p = put(p, static_cast<uint64>(length), 8);
+        p = put(p, name_len, 4);
+        if (namesize > 0) {
+            memcpy(p, name, namesize);
+            p += namesize;
+        }
+        if (length > 0)
+            memcpy(p, data, static_cast<size_t>(length));
+        return frame;
+    }
+
+    // parse the frame, the name and payload point into buf. return false if broken.
+    bool decode(const char *buf, size_t size)
+    {
+        if (size < FRAME_HEADER_SIZE || get(buf, 4) != FRAME_MAGIC)
+            return false;
+        job_id = static_cast<int32>(get(buf + 4, 4));
+        file_id = static_cast<int32>(get(buf + 8, 4));
+        flags = static_cast<int32>(get(buf + 12, 4));
+        blk_id = static_cast<int64>(get(buf + 16, 8));
+        data_size = static_cast<int64>(get(buf + 24, 8));
+        length = static_cast<int64>(get(buf + 32, 8));
+        name_len = static_cast<uint32>(get(buf + 40, 4));
+
+        size_t namesize = name_len == FRAME_SAME_NAME ? 0 : name_len;
+        if (length < 0 || size != FRAME_HEADER_SIZE + namesize + static_cast<uint64>(length))
+            return false;
+        name = buf + FRAME_HEADER_SIZE;
+        payload = name + namesize;
+        return true;
+    }
+
+private:
+    static char *put(char *p, uint64 value, int bytes)
+    {
+        for (int i = 0; i < bytes; ++i)
+            p[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        return p + bytes;
+    }
+
+    static uint64 get(const char *p, int bytes)
+    {
+        uint64 value = 0;
+        for (int i = bytes - 1; i >= 0; --i)
+            value = (value << 8) | static_cast<uint8>(p[i]);
+        return value;
+    }
+};
+
+#endif // BLOCKFRAME_H
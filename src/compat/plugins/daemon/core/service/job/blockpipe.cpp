@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "blockpipe.h"
+#include "co/time.h"
+
+static uint32 roundSlots(uint32 slots)
+{
+    uint32 n = 2;
+    while (n < slots)
+        n <<= 1;
+    return n;
+}
+
+BlockPipe::BlockPipe(int64 capacity, uint32 slots)
+    : _slots(roundSlots(slots))
+    , _mask(_slots.size() - 1)
+    , _capacity(capacity)
+{
+}
+
+bool BlockPipe::push(const QSharedPointer<FSDataBlock> &block, bool bounded)
+{
+    int64 size = static_cast<int64>(block->data.size());
+    while (!_closed.load(std::memory_order_acquire)) {
+        uint64 tail = _tail.load(std::memory_order_relaxed);
+        bool full = tail - _head.load(std::memory_order_acquire) > _mask;
+        if (!full && bounded) {
+            int64 used = _bytes.load(std::memory_order_acquire);
+            full = used > 0 && used + size > _capacity;
+        }
+        if (!full) {
+            _slots[tail & _mask] = block;
+            _bytes.fetch_add(size, std::memory_order_release);
+            _tail.store(tail + 1, std::memory_order_release);
+            _readable.signal();
+            return true;
+        }
+        // the consumer signals after each pop, the timeout only guards the close
+        _writable.wait(100);
+    }
+    return false;
+}
+
+QSharedPointer<FSDataBlock> BlockPipe::pop(uint32 ms)
+{
+    int64 deadline = co::now::ms() + ms;
+    while (!_closed.load(std::memory_order_acquire)) {
+        uint64 head = _head.load(std::memory_order_relaxed);
+        if (head != _tail.load(std::memory_order_acquire)) {
+            QSharedPointer<FSDataBlock> block;
+            block.swap(_slots[head & _mask]);
+            _head.store(head + 1, std::memory_order_release);
+            _bytes.fetch_sub(static_cast<int64>(block->data.size()), std::memory_order_release);
+            _writable.signal();
+            return block;
+        }
+
+        int64 left = deadline - co::now::ms();
+        if (left <= 0 || !_readable.wait(static_cast<uint32>(left)))
+            break;
+    }
+    return nullptr;
+}
+
+void BlockPipe::close()
+{
+    _closed.store(true, std::memory_order_release);
+    _readable.signal();
+    _writable.signal();
+}
+
+int BlockPipe::count() const
+{
+    return static_cast<int>(_tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire));
+}
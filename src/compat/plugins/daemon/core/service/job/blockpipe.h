@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef BLOCKPIPE_H
+#define BLOCKPIPE_H
+
+#include "service/comshare.h"
+#include "co/co.h"
+
+#include <QSharedPointer>
+#include <atomic>
+#include <vector>
+
+// The single-producer/single-consumer ring between the reader and the sender (or the rpc
+// handler and the writer) of a TransferJob. The slots are handed over by the head and tail
+// indexes without lock, the blocked side is woken by the events instead of polling.
+// The capacity is bounded by the bytes of the block data, a block larger than the capacity
+// is accepted while the pipe is empty.
+class BlockPipe
+{
+public:
+    explicit BlockPipe(int64 capacity, uint32 slots = 1024);
+
+    // called by the producer only. If bounded, wait until the data fits in the capacity,
+    // otherwise only wait for a free slot. Return false if the pipe is closed.
+    bool push(const QSharedPointer<FSDataBlock> &block, bool bounded = true);
+
+    // called by the consumer only, wait for a block up to ms. Return null if timed out or closed.
+    QSharedPointer<FSDataBlock> pop(uint32 ms);
+
+    // wake up and refuse the both sides, the blocks left are released with the pipe.
+    void close();
+
+    int count() const;
+    int64 bytes() const { return _bytes.load(std::memory_order_relaxed); }
+    void setCapacity(int64 capacity) { _capacity = capacity; }
+
+private:
+    std::vector<QSharedPointer<FSDataBlock>> _slots;
+    const uint64 _mask;
+    int64 _capacity;
+
+    std::atomic<uint64> _head { 0 }; // written by consumer
+    std::atomic<uint64> _tail { 0 }; // written by producer
+    std::atomic<int64> _bytes { 0 };
+    std::atomic_bool _closed { false };
+
+    co::event _readable;
+    co::event _writable;
+};
+
+#endif // BLOCKPIPE_H
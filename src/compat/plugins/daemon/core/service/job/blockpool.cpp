@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "blockpool.h"
+#include "common/constant.h"
+
+DEF_int32(pool_mb, 32, "the max MB of idle block buffers kept for reuse");
+
+// 0 for the blocks without data (dir, counting...), the largest one is a file block
+const size_t BlockPool::CLASS_SIZES[CLASS_COUNT] = { 0, 64 * 1024, 256 * 1024, BLOCK_SIZE };
+
+BlockPool *BlockPool::instance()
+{
+    // never destroyed, the blocks may still be released by the jobs while exiting
+    static BlockPool *pool = new BlockPool();
+    return pool;
+}
+
+BlockPool::BlockPool()
+{
+}
+
+QSharedPointer<FSDataBlock> BlockPool::take(size_t size)
+{
+    auto deleter = [](FSDataBlock *block) { BlockPool::instance()->recycle(block); };
+
+    int cls = 0;
+    while (cls < CLASS_COUNT && CLASS_SIZES[cls] < size)
+        cls++;
+    if (cls == CLASS_COUNT) {
+        // too large to keep, allocate as before
+        QSharedPointer<FSDataBlock> block(new FSDataBlock);
+        block->data.reserve(size);
+        return block;
+    }
+
+    FSDataBlock *block = nullptr;
+    {
+        co::mutex_guard g(_mutex);
+        if (!_free[cls].empty()) {
+            block = _free[cls].back();
+            _free[cls].pop_back();
+            _idle_bytes -= static_cast<int64>(block->data.capacity());
+        }
+    }
+    if (!block) {
+        block = new FSDataBlock;
+        block->data.reserve(CLASS_SIZES[cls]);
+    }
+    return QSharedPointer<FSDataBlock>(block, deleter);
+}
+
+int64 BlockPool::idleBytes()
+{
+    co::mutex_guard g(_mutex);
+    return _idle_bytes;
+}
+
+void BlockPool::recycle(FSDataBlock *block)
+{
+    // the buffer grown by the user still fits the class under its capacity
+    size_t cap = block->data.capacity();
+    int cls = CLASS_COUNT - 1;
+    while (cls > 0 && CLASS_SIZES[cls] > cap)
+        cls--;
+
+    {
+        co::mutex_guard g(_mutex);
+        if (_idle_bytes + static_cast<int64>(cap) <= (static_cast<int64>(FLG_pool_mb) << 20)) {
+            block->job_id = 0;
+            block->file_id = 0;
+            block->rootdir.clear();
+            block->filename.clear();
+            block->blk_id = 0;
+            block->flags = 0;
+            block->data_size = 0;
+            block->data.clear();
+            _free[cls].push_back(block);
+            _idle_bytes += static_cast<int64>(cap);
+            return;
+        }
+    }
+    delete block;
+}
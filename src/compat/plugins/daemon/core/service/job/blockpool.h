@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef BLOCKPOOL_H
+#define BLOCKPOOL_H
+
+#include "service/comshare.h"
+#include "co/co.h"
+
+#include <QSharedPointer>
+#include <vector>
+
+// The size-classed pool of FSDataBlock shared by the readers, senders and writers of all jobs.
+// A block taken from the pool goes back to it with its data buffer when the last reference is
+// released, i.e. after the block has been sent or written, so a transfer reuses a few buffers
+// instead of allocating one per block.
+class BlockPool
+{
+public:
+    static BlockPool *instance();
+
+    // take an empty block whose data can hold size bytes without allocation.
+    QSharedPointer<FSDataBlock> take(size_t size = 0);
+
+    int64 idleBytes();
+
+private:
+    BlockPool();
+    void recycle(FSDataBlock *block);
+
+    enum { CLASS_COUNT = 4 };
+    static const size_t CLASS_SIZES[CLASS_COUNT];
+
+    co::mutex _mutex;
+    std::vector<FSDataBlock *> _free[CLASS_COUNT];
+    int64 _idle_bytes { 0 };
+};
+
+#endif // BLOCKPOOL_H
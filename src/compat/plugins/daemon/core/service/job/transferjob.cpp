@@ -14,6 +14,8 @@
 #include "service/ipc/sendipcservice.h"
 #include "utils/config.h"
 #include "service/comshare.h"
+#include "blockframe.h"
+#include "blockpool.h"
 
 #include "ipc/bridge.h"
 
@@ -21,8 +23,14 @@
 #include <QElapsedTimer>
 #include <QStorageInfo>
 
+DEF_int32(send_window, 16, "the max FS_DATA blocks in flight, 1 to wait for the reply one by one");
+DEF_int32(pipe_mb, 16, "the max MB of file data buffered in a transfer job");
+DEF_int32(scan_workers, 4, "the workers to walk the dirs of a send job");
+
 TransferJob::TransferJob(QObject *parent)
     : QObject(parent)
+    , _block_pipe(static_cast<int64>(FLG_pipe_mb) << 20)
+    , _writeback(static_cast<int64>(FLG_pipe_mb) << 20)
 {
     _status = NONE;
 }
@@ -30,13 +38,8 @@ TransferJob::TransferJob(QObject *parent)
 TransferJob::~TransferJob()
 {
     _status = STOPED;
-    if (fx != nullptr) {
-        // 主动释放文件句柄，否则取消或异常时在win上有可能导致一直被占用
-        LOG << "release fd for file:" << fx->path();
-        fx->close();
-        delete fx;
-        fx = nullptr;
-    }
+    // 主动释放文件句柄，否则取消或异常时在win上有可能导致一直被占用
+    _writeback.stop();
 }
 
 bool TransferJob::initRpc(fastring target, uint16 port)
@@ -80,6 +83,15 @@ bool TransferJob::initRpc(fastring target, uint16 port)
             this->_init_success = false;
             return false;
         }
+
+        co::Json resJson;
+        if (resJson.parse_from(res.data)) {
+            FileTransResponse transres;
+            transres.from_json(resJson);
+            // 旧版本接收端只能处理json的FS_DATA
+            _block_frame = transres.feature & TRANS_FEATURE_BLOCK_FRAME;
+        }
+        DLOG << "(" << _jobid << ") send blocks in frame: " << _block_frame;
     }
     return true;
 }
@@ -168,27 +180,40 @@ void TransferJob::start()
         QUNIGO([this]() {
             co::Json pathJson;
             pathJson.parse_from(_path);
-            for (uint32 i = 0; i < pathJson.array_size(); i++) {
-                fastring jobpath = pathJson[i].as_string();
-                std::pair<fastring, fastring> pairs = path::split(jobpath);
-                fastring rootpath = pairs.first.c_str();
-                scanPath(rootpath, jobpath, true);
-            }
-            QSharedPointer<FSDataBlock> blocks(new FSDataBlock);
-            blocks->job_id = _jobid;
-            blocks->data_size = _total_size;
-            // copy binrary data
-            blocks->flags = JobTransFileOp::FILE_COUNTED;
-            pushQueque(blocks);
-
             DLOG << "read job start path: " << pathJson;
+            // 单次并行遍历：边扫描边读取，统计的总大小随扫描增长
+            TreeScanner scanner(FLG_scan_workers);
             for (uint32 i = 0; i < pathJson.array_size(); i++) {
                 fastring jobpath = pathJson[i].as_string();
                 std::pair<fastring, fastring> pairs = path::split(jobpath);
-                fastring rootpath = pairs.first.c_str();
-                scanPath(rootpath, jobpath, false);
+                scanner.addPath(pairs.first.c_str(), jobpath);
             }
-            QSharedPointer<FSDataBlock> block(new FSDataBlock);
+            scanner.start();
+
+            int64 counted = -1;
+            int64 counted_time = 0;
+            ScanEntry entry;
+            while (_status < STOPED && !scanner.done()) {
+                if (scanner.failed()) {
+                    ELOG << "get file entry error !!!!";
+                    cancel();
+                    break;
+                }
+                bool got = scanner.next(&entry, 100);
+                int64 total = scanner.totalSize();
+                if (total != counted && (counted < 0 || co::now::ms() - counted_time >= 500)) {
+                    pushCounted(total);
+                    counted = total;
+                    counted_time = co::now::ms();
+                }
+                if (got)
+                    readEntry(entry);
+            }
+            scanner.stop();
+            if (scanner.totalSize() != counted && !scanner.failed())
+                pushCounted(scanner.totalSize());
+
+            QSharedPointer<FSDataBlock> block = BlockPool::instance()->take();
             block->job_id = _jobid;
             block->data_size = 0;
             // copy binrary data
@@ -210,6 +235,7 @@ void TransferJob::stop(const bool notify)
     _not_notify = !notify;
     DLOG << "(" << _jobid << ") stop now!";
     atomic_store(&_status, STOPED);
+    _block_pipe.close();
 }
 
 void TransferJob::waitFinish()
@@ -252,7 +278,6 @@ void TransferJob::cancel(bool notify)
 
 void TransferJob::pushQueque(const QSharedPointer<FSDataBlock> block)
 {
-    QWriteLocker g(&_queque_mutex);
     if (_status == CANCELING || _status == STOPED) {
         DLOG << "This job has mark cancel or stoped, stop handle data.";
         return;
@@ -264,7 +289,9 @@ void TransferJob::pushQueque(const QSharedPointer<FSDataBlock> block)
         block->rootdir = (_save_fulldir);
     }
 
-    _block_queue.enqueue(block);
+    // 数据块受内存上限约束：接收端等待写入消化后才回复，发送窗口随之停住；
+    // 控制块（创建目录/文件、结束）没有数据，不受限制，避免卡在满队列之后
+    _block_pipe.push(block, !_writejob || !block->data.empty());
 }
 
 qint64 TransferJob::freeBytes() const
@@ -272,6 +299,14 @@ qint64 TransferJob::freeBytes() const
     return _device_free_size;
 }
 
+fastring TransferJob::frameName(const char *name, uint32 len)
+{
+    // 只在rpc处理线程中调用
+    if (len != FRAME_SAME_NAME)
+        _frame_name = fastring(name, len);
+    return _frame_name;
+}
+
 bool TransferJob::offlineCancel(const QString &ip)
 {
     if (_offlined || ip.isEmpty() || ip != QString(_tar_ip.c_str()))
@@ -298,28 +333,31 @@ void TransferJob::handleBlockQueque()
     QElapsedTimer time;
     time.start();
     int64 timeold = 0;
-    if (!_writejob)
-        createSendCounting();
-    // 发送当前统计文件中block
+    // 先发送统计中的block
+    QSharedPointer<FSDataBlock> counting = _writejob ? nullptr : createSendCounting();
     while (_status != STOPED) {
         if (_status == CANCELING) {
             exception = true;
             break;
         }
+        // 等待数据块，最多到下一次计时
+        auto block = counting;
+        counting.reset();
+        if (block.isNull()) {
+            int64 left = 500 - (time.elapsed() - timeold);
+            block = popQueue(left > 0 ? static_cast<uint32>(left) : 0);
+        }
         // 计时器处理
         bool timeout = false;
         if (time.elapsed() - timeold >= 500) {
             timeold = time.elapsed();
             timeout = true;
         }
-        auto block = popQueue();
-        if (block.isNull() && (_writejob || (!timeout && !counted))) {
-            co::sleep(10);
+        if (block.isNull() && (_writejob || (!timeout && !counted)))
             continue;
-        }
 
         if (block.isNull()) {
-            block.reset(new FSDataBlock);
+            block = BlockPool::instance()->take();
             block->flags = JobTransFileOp::FILE_COUNTING;
         }
 
@@ -332,8 +370,13 @@ void TransferJob::handleBlockQueque()
         bool reacquired = false;
         //加解密文件名，防止路径特殊导致序列化卡住
         if (!block->filename.empty()) {
-            fastring filename = _writejob ? Util::decodeBase64(block->filename.c_str())
-                                          : Util::encodeBase64(block->filename.c_str());
+            // 同一文件的数据块连续到达，文件名变化时才重新编解码
+            if (block->filename != _coded_name.first) {
+                _coded_name.first = block->filename;
+                _coded_name.second = _writejob ? Util::decodeBase64(block->filename.c_str())
+                                               : Util::encodeBase64(block->filename.c_str());
+            }
+            fastring filename = _coded_name.second;
 
             //真实全路径，写文件和通知
             fullpath = getSaveFullpath(block->rootdir, _writejob ? filename : block->filename);
@@ -406,6 +449,9 @@ void TransferJob::handleBlockQueque()
     LOG << "trans job end: " << _jobid << " freebytes = " << _device_free_size
         << "  not enought = " << _device_not_enough;
     atomic_store(&_status, STOPED);
+    // 唤醒可能阻塞在满队列上的读取端
+    _block_pipe.close();
+    _writeback.stop();
 }
 
 void TransferJob::handleUpdate(FileTransRe result, const char *path, const char *emsg)
@@ -451,75 +497,48 @@ void TransferJob::handleTransStatus(int status, const FileInfo &info)
     emit notifyFileTransStatus(appname, status, fileinfo);
 }
 
-QSharedPointer<FSDataBlock> TransferJob::popQueue()
+QSharedPointer<FSDataBlock> TransferJob::popQueue(uint32 ms)
 {
-    QWriteLocker g(&_queque_mutex);
-    if (_block_queue.empty())
-        return nullptr;
-    return _block_queue.dequeue();
+    return _block_pipe.pop(ms);
 }
 
 int TransferJob::queueCount() const
 {
-    QReadLocker g(&_queque_mutex);
-    return _block_queue.count();
+    return _block_pipe.count();
 }
 
-void TransferJob::scanPath(const fastring root, const fastring path, const bool acTotal)
+void TransferJob::pushCounted(int64 total)
 {
-#ifdef linux
-    // 链接文件不拷贝
-    if (fs::isSymlink(path.c_str()))
-        return;
-#endif
-    _fileid++;
-    fastring subdir = getSubdir(path.c_str(), root.c_str());
-    FileEntry *entry = new FileEntry();
-    if (FSAdapter::getFileEntry(path.c_str(), &entry) < 0) {
-        ELOG << "get file entry error !!!!";
-        cancel();
-        return;
-    }
-
-    if (_status >= STOPED)
-        return;
-    if (fs::isdir(path.c_str())) {
-        _total_size += 4096;
-        if (!acTotal) {
-            QSharedPointer<FSDataBlock> block(new FSDataBlock);
-            block->job_id = _jobid;
-            block->rootdir = root;
-            auto file = path;
-            block->filename = file.replace(root, "");
-            block->blk_id = 0;
-            block->flags = JobTransFileOp::FIlE_DIR_CREATE;
-            block->data_size = 0;
-            pushQueque(block);
-        }
-        // 发送文件创建操作
-        readPath(path, root, acTotal);
-    } else {
-        readFile(path, _fileid, subdir.c_str(), acTotal);
-    }
+    // 接收端每次收到都会更新总大小并检查磁盘空间
+    _total_size = total;
+    QSharedPointer<FSDataBlock> block = BlockPool::instance()->take();
+    block->job_id = _jobid;
+    block->data_size = total;
+    block->flags = JobTransFileOp::FILE_COUNTED;
+    pushQueque(block);
 }
 
-void TransferJob::readPath(fastring path, fastring root, const bool acTotal)
+void TransferJob::readEntry(const ScanEntry &entry)
 {
-    if (_status >= STOPED)
-        return;
-
-    fastring dirpath = path::join(path, "");
-    fs::dir d(dirpath);
-    auto v = d.all();   // 读取所有子项
-    for (const fastring &file : v) {
-        if (_status >= STOPED)
-            return;
-        fastring file_path = path::join(d.path(), file.c_str());
-        scanPath(root, file_path, acTotal);
+    _fileid++;
+    if (entry.dir) {
+        // 发送目录创建操作
+        QSharedPointer<FSDataBlock> block = BlockPool::instance()->take();
+        block->job_id = _jobid;
+        block->rootdir = entry.root;
+        auto file = entry.path;
+        block->filename = file.replace(entry.root, "");
+        block->blk_id = 0;
+        block->flags = JobTransFileOp::FIlE_DIR_CREATE;
+        block->data_size = 0;
+        pushQueque(block);
+    } else {
+        fastring subdir = getSubdir(entry.path.c_str(), entry.root.c_str());
+        readFile(entry.path, _fileid, subdir, entry.size);
     }
 }
 
-bool TransferJob::readFile(fastring filepath, int fileid, fastring subdir, const bool acTotal)
+bool TransferJob::readFile(fastring filepath, int fileid, fastring subdir, const int64 file_size)
 {
     if (_status >= STOPED)
         return false;
@@ -529,13 +548,14 @@ bool TransferJob::readFile(fastring filepath, int fileid, fastring subdir, const
     fastring filename = pairs.second;
 
     fastring subname = path::join(subdir, filename.c_str());
-    readFileBlock(filepath, fileid, subname, acTotal);
+    readFileBlock(filepath, fileid, subname, file_size);
     return true;
 }
 
-void TransferJob::readFileBlock(fastring filepath, int fileid, const fastring subname, const bool acTotal)
+void TransferJob::readFileBlock(fastring filepath, int fileid, const fastring subname, const int64 file_size)
 {
-    if (filepath.empty() || fileid < 0 || !fs::exists(filepath)) {
+    // 大小来自扫描结果，不再重复stat
+    if (filepath.empty() || fileid < 0) {
         ELOG << "readFileBlock file is invaild" << filepath;
         return;
     }
@@ -544,12 +564,6 @@ void TransferJob::readFileBlock(fastring filepath, int fileid, const fastring su
         return;
 
     size_t block_size = BLOCK_SIZE;
-    int64 file_size = fs::fsize(filepath);
-
-    if (acTotal) {
-        _total_size += static_cast<int64>(file_size <= 0 ? 4096 : file_size);
-        return;
-    }
 
     // 文件所在根目录
     auto file = filepath;
@@ -557,7 +571,7 @@ void TransferJob::readFileBlock(fastring filepath, int fileid, const fastring su
 
     if (file_size <= 0) {
         // error file or 0B file.
-        QSharedPointer<FSDataBlock> block(new FSDataBlock);
+        QSharedPointer<FSDataBlock> block = BlockPool::instance()->take();
         block->job_id = _jobid;
         block->file_id = fileid;
         block->rootdir = root;
@@ -578,28 +592,23 @@ void TransferJob::readFileBlock(fastring filepath, int fileid, const fastring su
         return;
     }
 
-    size_t block_len = block_size * sizeof(char);
-    char *buf = reinterpret_cast<char *>(malloc(block_len));
     size_t resize = 0;
     bool open = true;
     do {
-        // 最多100个数据块->100M 限制内存使用
-        if (self && self->queueCount() > 100) {
-            co::sleep(10);
-            continue;
-        }
-
+        // 队列按字节限制内存使用，满时pushQueque阻塞等待
         if (self.isNull() || self->_status >= STOPED)
             break;
 
-        memset(buf, 0, block_len);
-        resize = fd.read(buf, block_size);
+        // 直接读入池中的缓冲区，发送完成后归还
+        QSharedPointer<FSDataBlock> block = BlockPool::instance()->take(block_size);
+        block->data.resize(block_size);
+        resize = fd.read(&block->data[0], block_size);
         if (resize > block_size) {
             LOG << "read file ERROR  resize = " << resize;
             break;
         }
+        block->data.resize(resize);
 
-        QSharedPointer<FSDataBlock> block(new FSDataBlock);
         if (self)
             block->job_id = self->_jobid;
         block->file_id = fileid;
@@ -611,9 +620,6 @@ void TransferJob::readFileBlock(fastring filepath, int fileid, const fastring su
         // 判断文件是否读取完成
         block->flags = (resize == 0 || read_size + static_cast<int64>(resize) >= file_size) ? block->flags | JobTransFileOp::FILE_CLOSE : block->flags;
         block->data_size = static_cast<int64>(resize);
-        // copy binrary data
-        fastring bufdata(buf, resize);
-        block->data = bufdata;
         if (self)
             self->pushQueque(block);
         open = false;
@@ -627,7 +633,6 @@ void TransferJob::readFileBlock(fastring filepath, int fileid, const fastring su
         block_id++;
     } while (read_size < file_size || (resize > 0 && resize == block_size));
 
-    free(buf);
     fd.close();
 }
 
@@ -649,21 +654,20 @@ bool TransferJob::writeAndCreateFile(const QSharedPointer<FSDataBlock> block, co
             return false;
         }
         return true;
-    } else if (block->flags & JobTransFileOp::FILE_COUNTING || block->flags & JobTransFileOp::FILE_TRANS_OVER) {
+    } else if (block->flags & JobTransFileOp::FILE_COUNTING) {
         return true;
+    } else if (block->flags & JobTransFileOp::FILE_TRANS_OVER) {
+        // 所有数据落盘后才算完成
+        return _writeback.flush();
     }
 
-    fastring buffer = block->data;
+    const fastring &buffer = block->data;
     size_t len = buffer.size();
     int64 offset = static_cast<int64>(block->blk_id * BLOCK_SIZE);
     // ELOG << "file : " << name << " write : " << len << " totol = " << _total_size << " curent " <<  _cur_size
     //      << "  flags !!! " << block->flags;
-    int count = 3;
-    bool good = false;
-    do {
-        good = FSAdapter::writeBlock(fullpath.c_str(), offset, buffer.c_str(), len, block->flags, &fx);
-        count--;
-    } while(!good && count > 0);
+    // 交给写回线程异步写入，失败在后续写入或结束时返回
+    bool good = _writeback.write(fullpath, offset, block);
 
 
     if (!good) {
@@ -682,30 +686,106 @@ bool TransferJob::sendToRemote(const QSharedPointer<FSDataBlock> block)
 {
     if (_device_not_enough)
         return false;
-    FileTransBlock file_block;
-    file_block.job_id = (_jobid);
-    file_block.file_id = (block->file_id);
-    file_block.rootdir = ""; // 重置文件根目录
-    file_block.filename = (block->filename.c_str());
-    file_block.blk_id = (static_cast<uint>(block->blk_id));
-    file_block.flags = block->flags;
-    file_block.data_size = block->data_size;
     _notify_fileid = block->file_id;
-    fastring buffer = block->data;
-    QByteArray data(buffer.c_str(), static_cast<int>(block->data.empty() ? 0 : block->data_size));
+    uint32 type = _block_frame ? FS_BLOCK : FS_DATA;
+    size_t size = block->data.empty() ? 0 : static_cast<size_t>(block->data_size);
+    QString msg;
+    std::string data;
+    if (_block_frame) {
+        // 二进制帧：数据只拷贝一次，文件名只在变化时发送
+        BlockFrame frame;
+        frame.job_id = _jobid;
+        frame.file_id = block->file_id;
+        frame.flags = block->flags;
+        frame.blk_id = block->blk_id;
+        frame.data_size = block->data_size;
+        frame.length = static_cast<int64>(size);
+        if (block->filename == _frame_name) {
+            frame.name_len = FRAME_SAME_NAME;
+        } else {
+            _frame_name = block->filename;
+            frame.name = _frame_name.data();
+            frame.name_len = static_cast<uint32>(_frame_name.size());
+        }
+        data = frame.encode(block->data.data());
+    } else {
+        FileTransBlock file_block;
+        file_block.job_id = (_jobid);
+        file_block.file_id = (block->file_id);
+        file_block.rootdir = ""; // 重置文件根目录
+        file_block.filename = (block->filename.c_str());
+        file_block.blk_id = (static_cast<uint>(block->blk_id));
+        file_block.flags = block->flags;
+        file_block.data_size = block->data_size;
+        msg = file_block.as_json().str().c_str();
+        data.assign(block->data.data(), size);
+    }
     // DLOG << "( ==== " << _jobid << ") send block " << block->filename << " size: " << block->data_size
     //     << " ----- = " << queueCount() << "  flags  == " << block->flags;
     SendResult res;
-    // 必须等待对方回复了才执行后面的流程
+    if (FLG_send_window <= 1) {
+        // 必须等待对方回复了才执行后面的流程
+        {
+            res.errorType = 0;
+            QMutexLocker g(&_send_mutex);
+            res = _remote->doSendProtoMsg(type, msg, std::move(data));
+        }
+        return handleSendResult(block, res);
+    }
+
+    // 流水线发送：不等待回复继续发送下一块，在途块数达到窗口时再依次处理回复
+    std::string seq;
+    {
+        QMutexLocker g(&_send_mutex);
+        res = _remote->sendProtoMsgAsync(type, msg, std::move(data), &seq);
+    }
+    if (res.errorType < INVOKE_OK)
+        return handleSendResult(block, res);
+    _sending_blocks.enqueue(qMakePair(seq, block));
+
+    // 传输结束前必须收齐所有回复
+    bool drain = block->flags & JobTransFileOp::FILE_TRANS_OVER;
+    while (!_sending_blocks.isEmpty() && (drain || _sending_blocks.size() >= sendWindow())) {
+        if (!waitSendReply())
+            return false;
+    }
+    return true;
+}
+
+bool TransferJob::waitSendReply()
+{
+    auto sending = _sending_blocks.dequeue();
+    SendResult res;
     {
-        res.errorType = 0;
         QMutexLocker g(&_send_mutex);
-        res = _remote->doSendProtoMsg(FS_DATA, file_block.as_json().str().c_str(), data);
+        res = _remote->waitProtoReply(_block_frame ? FS_BLOCK : FS_DATA, sending.first);
     }
+    bool ok = handleSendResult(sending.second, res);
+    if (!ok)
+        _sending_blocks.clear();
+    return ok;
+}
+
+int TransferJob::sendWindow() const
+{
+    // 接收端写入跟不上时缩小窗口，直到其队列消化
+    int window = FLG_send_window;
+    if (_remote_queue > window)
+        return 1;
+    if (_remote_queue > window / 2)
+        return qMax(1, window / 2);
+    return window;
+}
+
+bool TransferJob::handleSendResult(const QSharedPointer<FSDataBlock> block, const SendResult &res)
+{
     co::Json resJson;
-    if (res.protocolType == FS_DATA && resJson.parse_from(res.data)) {
+    if ((res.protocolType == FS_DATA || res.protocolType == FS_BLOCK) && resJson.parse_from(res.data)) {
         FileTransResponse transres;
         transres.from_json(resJson);
+        _remote_queue = transres.queue;
+        if (transres.blk_id != 0 && transres.blk_id != block->blk_id)
+            WLOG << "remote reply block " << transres.blk_id << " but sent " << block->blk_id;
         if (transres.result == IO_ERROR) {
             DLOG << "remote return: IO_ERROR!";
             _device_not_enough = block->flags & JobTransFileOp::FILE_COUNTED;
@@ -745,11 +825,12 @@ bool TransferJob::sendToRemote(const QSharedPointer<FSDataBlock> block)
     return true;
 }
 
-void TransferJob::createSendCounting()
+QSharedPointer<FSDataBlock> TransferJob::createSendCounting()
 {
-    QSharedPointer<FSDataBlock> block(new FSDataBlock);
+    // 由发送循环直接处理，读取协程是队列唯一的生产者
+    QSharedPointer<FSDataBlock> block = BlockPool::instance()->take();
     block->job_id = _jobid;
     block->flags = JobTransFileOp::FILE_COUNTING;
     block->data_size = 0;
-    pushQueque(block);
+    return block;
 }
@@ -14,6 +14,9 @@
 #include "co/co.h"
 #include "co/fs.h"
 #include "co/time.h"
+#include "blockpipe.h"
+#include "writeback.h"
+#include "treescanner.h"
 #include <QMutex>
 #include <QReadWriteLock>
 
@@ -40,10 +43,13 @@ public:
     void cancel(bool notify = false);
 
     void pushQueque(const QSharedPointer<FSDataBlock> block);
+    int queueCount() const;
     bool initSuccess() const { return _init_success; }
     void setDeviceNotenough();
     qint64 freeBytes() const;
     bool offlineCancel(const QString &ip);
+    // the file name of the received block frame, it is only sent while changed.
+    fastring frameName(const char *name, uint32 len);
 
 signals:
     // 传输作业结果通知：文件（目录），结果，保存路径
@@ -68,19 +74,22 @@ private:
     void handleUpdate(FileTransRe result, const char *path, const char *emsg);
     void handleJobStatus(int status);
     void handleTransStatus(int status, const FileInfo &info);
-    QSharedPointer<FSDataBlock> popQueue();
-    int queueCount() const;
+    QSharedPointer<FSDataBlock> popQueue(uint32 ms);
     void setFileName(const fastring &name, const fastring &acName);
     fastring acName(const fastring &name);
     fastring getSaveFullpath(const fastring &rootdir, const fastring &filename);
 
-    void scanPath(const fastring root,const fastring path, const bool acTotal);
-    void readPath(fastring path, fastring root, const bool acTotal);
-    bool readFile(fastring filepath, int fileid, fastring subdir, const bool acTotal);
-    void readFileBlock(fastring filepath, int fileid, const fastring subname, const  bool acTotal);
+    void pushCounted(int64 total);
+    void readEntry(const ScanEntry &entry);
+    bool readFile(fastring filepath, int fileid, fastring subdir, const int64 file_size);
+    void readFileBlock(fastring filepath, int fileid, const fastring subname, const int64 file_size);
     bool writeAndCreateFile(const QSharedPointer<FSDataBlock> block, const fastring fullpath);
     bool sendToRemote(const QSharedPointer<FSDataBlock> block);
-    void createSendCounting();
+    // take the reply of the oldest block in flight
+    bool waitSendReply();
+    bool handleSendResult(const QSharedPointer<FSDataBlock> block, const SendResult &res);
+    int sendWindow() const;
+    QSharedPointer<FSDataBlock> createSendCounting();
 
 private:
     int _jobid;
@@ -108,13 +117,21 @@ private:
     fastring _tar_ip;
     std::atomic_int64_t _device_free_size{ -1 };
 
-    mutable QReadWriteLock _queque_mutex;
-    QQueue<QSharedPointer<FSDataBlock>> _block_queue;
+    // the blocks from the reader (or the rpc handler) to handleBlockQueque
+    BlockPipe _block_pipe;
     QSharedPointer<RemoteServiceSender> _remote;
     QReadWriteLock _file_name_maps_lock;
     QMap<fastring, fastring> _file_name_maps;
     QMutex _send_mutex;
-    fs::file *fx{ nullptr };
+    // the pipelined blocks which have been sent but not replied: <seq, block>
+    QQueue<QPair<std::string, QSharedPointer<FSDataBlock>>> _sending_blocks;
+    int _remote_queue { 0 }; // the blocks waiting to write in receiver
+    bool _block_frame { false }; // the receiver accepts FS_BLOCK
+    fastring _frame_name; // the last file name in the block frame
+    // the blocks of one file come together, code the name only once: <name, coded>
+    QPair<fastring, fastring> _coded_name;
+    // the blocks of the receive job are written by it
+    WriteBack _writeback;
 };
 
 #endif   // TRANSFERJOB_H
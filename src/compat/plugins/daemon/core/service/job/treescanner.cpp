@@ -0,0 +1,252 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "treescanner.h"
+#include "co/fs.h"
+#include "co/log.h"
+#include "co/path.h"
+#include "co/time.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#ifdef linux
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// the entries of a dir are handed to the consumer in batches
+#define SCAN_BATCH 128
+#define DIR_SIZE 4096
+
+struct TreeScanner::State {
+    co::mutex mutex;
+    std::deque<std::pair<fastring, fastring>> dirs; // <root, dir> waiting to list
+    int pending { 0 }; // the dirs waiting or being listed
+    std::deque<ScanEntry> entries;
+    co::event dir_ready;
+    co::event entry_ready;
+    std::atomic_bool stopped { false };
+    std::atomic_bool failed { false };
+    std::atomic<int64> total { 0 };
+
+    void add(std::vector<ScanEntry> &batch);
+    void listDir(const fastring &root, const fastring &dir);
+    void work();
+};
+
+void TreeScanner::State::add(std::vector<ScanEntry> &batch)
+{
+    if (batch.empty())
+        return;
+
+    bool hasDir = false;
+    int64 size = 0;
+    {
+        co::mutex_guard g(mutex);
+        for (auto &entry : batch) {
+            size += (entry.dir || entry.size <= 0) ? DIR_SIZE : entry.size;
+            if (entry.dir) {
+                // 目录先于其子项交给读取端
+                dirs.emplace_back(entry.root, entry.path);
+                pending++;
+                hasDir = true;
+            }
+            entries.push_back(std::move(entry));
+        }
+    }
+    total += size;
+    batch.clear();
+    entry_ready.signal();
+    if (hasDir)
+        dir_ready.signal();
+}
+
+void TreeScanner::State::listDir(const fastring &root, const fastring &dir)
+{
+    std::vector<ScanEntry> batch;
+    auto push = [&](const fastring &path, bool isDir, int64 size) {
+        ScanEntry entry;
+        entry.root = root;
+        entry.path = path;
+        entry.dir = isDir;
+        entry.size = size;
+        batch.push_back(std::move(entry));
+        if (batch.size() >= SCAN_BATCH)
+            add(batch);
+    };
+
+#ifdef linux
+    // 按目录句柄读取子项，类型来自d_type，只对普通文件取大小
+    int dfd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    DIR *d = dfd < 0 ? nullptr : fdopendir(dfd);
+    if (!d) {
+        // 无权限读取的目录跳过，不中断整个任务
+        ELOG << "scan skip the unreadable dir: " << dir;
+        if (dfd >= 0)
+            ::close(dfd);
+        return;
+    }
+    struct dirent *ent = nullptr;
+    while (!stopped && (ent = readdir(d)) != nullptr) {
+        const char *name = ent->d_name;
+        if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+            continue;
+
+        unsigned char type = ent->d_type;
+        struct stat st;
+        st.st_size = 0;
+        if (type == DT_UNKNOWN || type == DT_REG) {
+            if (fstatat(dfd, name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+                ELOG << "scan skip the unreadable file: " << name << " in " << dir;
+                continue;
+            }
+            type = S_ISDIR(st.st_mode) ? DT_DIR : (S_ISLNK(st.st_mode) ? DT_LNK : DT_REG);
+        }
+        // 链接文件不拷贝
+        if (type == DT_LNK)
+            continue;
+        push(path::join(dir, name), type == DT_DIR, type == DT_DIR ? 0 : static_cast<int64>(st.st_size));
+    }
+    closedir(d);
+#else
+    fs::dir d(path::join(dir, ""));
+    auto v = d.all();
+    for (const fastring &file : v) {
+        if (stopped)
+            break;
+        fastring file_path = path::join(d.path(), file.c_str());
+        bool isDir = fs::isdir(file_path);
+        push(file_path, isDir, isDir ? 0 : fs::fsize(file_path));
+    }
+#endif
+    add(batch);
+}
+
+void TreeScanner::State::work()
+{
+    while (!stopped) {
+        std::pair<fastring, fastring> job;
+        bool got = false;
+        {
+            co::mutex_guard g(mutex);
+            if (!dirs.empty()) {
+                job = std::move(dirs.front());
+                dirs.pop_front();
+                got = true;
+            } else if (pending == 0) {
+                break;
+            }
+        }
+        if (!got) {
+            // 其他worker正在读取的目录可能还会产生子目录
+            dir_ready.wait(50);
+            continue;
+        }
+
+        listDir(job.first, job.second);
+        {
+            co::mutex_guard g(mutex);
+            pending--;
+        }
+        entry_ready.signal();
+    }
+    // wake up the others to exit
+    dir_ready.signal();
+}
+
+TreeScanner::TreeScanner(int workers)
+    : _state(new State)
+    , _workers(workers < 1 ? 1 : workers)
+{
+}
+
+TreeScanner::~TreeScanner()
+{
+    stop();
+}
+
+void TreeScanner::addPath(const fastring &root, const fastring &path)
+{
+#ifdef linux
+    if (fs::isSymlink(path.c_str()))
+        return;
+#endif
+    if (!fs::exists(path)) {
+        ELOG << "scan path not exists: " << path;
+        _state->failed = true;
+        return;
+    }
+
+    std::vector<ScanEntry> batch(1);
+    batch[0].root = root;
+    batch[0].path = path;
+    batch[0].dir = fs::isdir(path);
+    batch[0].size = batch[0].dir ? 0 : fs::fsize(path);
+    _state->add(batch);
+}
+
+void TreeScanner::start()
+{
+    for (int i = 0; i < _workers; ++i) {
+        auto state = _state;
+        // same as UNIGO, common/constant.h is not included for its DIR conflicts with dirent.h
+#if defined(DISABLE_GO)
+        std::thread([state]() {
+            state->work();
+        }).detach();
+#else
+        go([state]() {
+            state->work();
+        });
+#endif
+    }
+}
+
+void TreeScanner::stop()
+{
+    _state->stopped = true;
+    _state->dir_ready.signal();
+    _state->entry_ready.signal();
+}
+
+bool TreeScanner::next(ScanEntry *entry, uint32 ms)
+{
+    int64 deadline = co::now::ms() + ms;
+    while (!_state->stopped) {
+        {
+            co::mutex_guard g(_state->mutex);
+            if (!_state->entries.empty()) {
+                *entry = std::move(_state->entries.front());
+                _state->entries.pop_front();
+                return true;
+            }
+            if (_state->pending == 0)
+                return false;
+        }
+        int64 left = deadline - co::now::ms();
+        if (left <= 0 || !_state->entry_ready.wait(static_cast<uint32>(left)))
+            return false;
+    }
+    return false;
+}
+
+bool TreeScanner::done()
+{
+    co::mutex_guard g(_state->mutex);
+    return _state->stopped || (_state->pending == 0 && _state->entries.empty());
+}
+
+bool TreeScanner::failed()
+{
+    return _state->failed;
+}
+
+int64 TreeScanner::totalSize()
+{
+    return _state->total;
+}
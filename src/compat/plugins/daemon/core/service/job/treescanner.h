@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef TREESCANNER_H
+#define TREESCANNER_H
+
+#include "co/co.h"
+#include "co/fastring.h"
+
+#include <deque>
+#include <memory>
+
+struct ScanEntry {
+    fastring root; // the parent dir of the selected path
+    fastring path;
+    bool dir { false };
+    int64 size { 0 };
+};
+
+// Walk the selected paths once with several workers. The entries are streamed to the consumer
+// as soon as they are found, a dir always comes before its children. The total size (4096 for
+// a dir or an empty file) grows while walking. Symlinks and the unreadable dirs are skipped on linux.
+class TreeScanner
+{
+public:
+    explicit TreeScanner(int workers);
+    ~TreeScanner();
+
+    // add a selected path before start
+    void addPath(const fastring &root, const fastring &path);
+    void start();
+    // stop the workers, the entries left are dropped
+    void stop();
+
+    // wait an entry up to ms, return false if none
+    bool next(ScanEntry *entry, uint32 ms);
+    // all paths are walked and all entries are taken
+    bool done();
+    // some selected path doesn't exist
+    bool failed();
+    int64 totalSize();
+
+private:
+    struct State;
+    std::shared_ptr<State> _state;
+    int _workers;
+};
+
+#endif // TREESCANNER_H
@@ -0,0 +1,296 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "writeback.h"
+#include "common/constant.h"
+#include "co/log.h"
+#include "co/path.h"
+
+#include <algorithm>
+#include <stdint.h>
+
+#ifdef linux
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// the blocks merged into one write at most
+#define MAX_IOV 64
+// preallocate the file by this step ahead of the writing
+#define RESERVE_STEP (32 * 1024 * 1024)
+
+WriteBack::WriteBack(int64 capacity)
+    : _capacity(capacity)
+{
+}
+
+WriteBack::~WriteBack()
+{
+    stop();
+}
+
+bool WriteBack::write(const fastring &path, int64 offset, const QSharedPointer<FSDataBlock> &block)
+{
+    if (_failed || _stoped)
+        return false;
+
+    if (!_thread.joinable())
+        _thread = std::thread(&WriteBack::run, this);
+
+    int64 size = static_cast<int64>(block->data.size());
+    while (true) {
+        {
+            co::mutex_guard g(_mutex);
+            // a block larger than the capacity is queued while empty
+            if (_bytes == 0 || _bytes + size <= _capacity) {
+                WriteOp op;
+                op.path = path;
+                op.offset = offset;
+                op.block = block;
+                _ops.push_back(std::move(op));
+                _bytes += size;
+                _pending++;
+                break;
+            }
+        }
+        _drained.wait(100);
+        if (_failed || _stoped)
+            return false;
+    }
+    _ready.signal();
+    return true;
+}
+
+bool WriteBack::flush()
+{
+    while (!_failed && !_stoped) {
+        {
+            co::mutex_guard g(_mutex);
+            if (_pending == 0)
+                break;
+        }
+        _drained.wait(100);
+    }
+    return !_failed;
+}
+
+void WriteBack::stop()
+{
+    _stoped = true;
+    _ready.signal();
+    if (_thread.joinable())
+        _thread.join();
+
+    co::mutex_guard g(_mutex);
+    _ops.clear();
+    _bytes = 0;
+    _pending = 0;
+}
+
+void WriteBack::run()
+{
+    while (true) {
+        std::deque<WriteOp> ops;
+        int64 bytes = 0;
+        size_t count = 0;
+        {
+            co::mutex_guard g(_mutex);
+            ops.swap(_ops);
+            count = ops.size();
+            for (const auto &op : ops)
+                bytes += static_cast<int64>(op.block->data.size());
+        }
+        if (ops.empty()) {
+            if (_stoped)
+                break;
+            _ready.wait(100);
+            continue;
+        }
+
+        if (!_failed && !_stoped)
+            writeOps(ops);
+        ops.clear(); // release the blocks before signal
+
+        {
+            co::mutex_guard g(_mutex);
+            _bytes -= bytes;
+            _pending -= static_cast<int>(count);
+        }
+        _drained.signal();
+    }
+    closeFile();
+}
+
+void WriteBack::writeOps(std::deque<WriteOp> &ops)
+{
+    size_t i = 0;
+    while (i < ops.size()) {
+        const WriteOp &op = ops[i];
+        if (op.block->flags & JobTransFileOp::FIlE_CREATE) {
+            if (!_path.empty()) {
+                // 上一个文件未关闭，先关闭
+                ELOG << "file flags is create, but file is opened: " << _path;
+                closeFile();
+            }
+            if (!openFile(op.path)) {
+                _failed = true;
+                return;
+            }
+        } else if (_path != op.path) {
+            ELOG << "write block to the file not opened: " << op.path << " flags = " << op.block->flags;
+            _failed = true;
+            return;
+        }
+
+        // 合并同一文件的相邻数据块
+        size_t end = i + 1;
+        int64 next = op.offset + static_cast<int64>(op.block->data.size());
+        while (end < ops.size() && end - i < MAX_IOV && !(ops[end - 1].block->flags & JobTransFileOp::FILE_CLOSE)) {
+            const WriteOp &more = ops[end];
+            if (more.path != op.path || more.offset != next || (more.block->flags & JobTransFileOp::FIlE_CREATE))
+                break;
+            next += static_cast<int64>(more.block->data.size());
+            end++;
+        }
+
+        if (!writeRun(ops, i, end)) {
+            _failed = true;
+            closeFile();
+            return;
+        }
+        if (ops[end - 1].block->flags & JobTransFileOp::FILE_CLOSE)
+            closeFile();
+        i = end;
+    }
+}
+
+#ifdef linux
+bool WriteBack::writeRun(const std::deque<WriteOp> &ops, size_t begin, size_t end)
+{
+    struct iovec iov[MAX_IOV];
+    int count = 0;
+    int64 offset = ops[begin].offset;
+    int64 total = 0;
+    for (size_t i = begin; i < end; ++i) {
+        const fastring &data = ops[i].block->data;
+        if (data.empty())
+            continue;
+        iov[count].iov_base = const_cast<char *>(data.data());
+        iov[count].iov_len = data.size();
+        total += static_cast<int64>(data.size());
+        count++;
+    }
+    if (count == 0)
+        return true;
+
+    if (offset + total > _reserved) {
+        // 预分配但不改变文件大小，不支持的文件系统忽略
+        int64 reserve = std::max<int64>(offset + total - _reserved, RESERVE_STEP);
+        if (fallocate(_fd, FALLOC_FL_KEEP_SIZE, _reserved, reserve) == 0)
+            _reserved += reserve;
+        else
+            _reserved = INT64_MAX;
+    }
+
+    struct iovec *cur = iov;
+    while (count > 0) {
+        ssize_t n = pwritev(_fd, cur, count, offset);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            ELOG << "write file failed: " << _path << " errno = " << errno;
+            return false;
+        }
+        offset += n;
+        // skip the written parts
+        size_t left = static_cast<size_t>(n);
+        while (count > 0 && left >= cur->iov_len) {
+            left -= cur->iov_len;
+            cur++;
+            count--;
+        }
+        if (count > 0) {
+            cur->iov_base = static_cast<char *>(cur->iov_base) + left;
+            cur->iov_len -= left;
+        }
+    }
+    return true;
+}
+
+bool WriteBack::openFile(const fastring &path)
+{
+    fs::mkdir(path::dir(path), true);   // 创建文件保存的根/子目录
+    _fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+    if (_fd < 0) {
+        ELOG << "file create error, file = " << path << " errno = " << errno;
+        return false;
+    }
+    _path = path;
+    _reserved = 0;
+    return true;
+}
+
+void WriteBack::closeFile()
+{
+    if (_fd < 0)
+        return;
+    if (_reserved > 0 && _reserved != INT64_MAX) {
+        // 释放超出文件末尾的预分配空间
+        struct stat st;
+        if (fstat(_fd, &st) == 0 && _reserved > st.st_size && ftruncate(_fd, st.st_size) != 0)
+            WLOG << "release the reserved space failed: " << _path;
+    }
+    ::close(_fd);
+    _fd = -1;
+    _path.clear();
+}
+#else
+bool WriteBack::writeRun(const std::deque<WriteOp> &ops, size_t begin, size_t end)
+{
+    // 不支持向量写的平台逐块写入
+    for (size_t i = begin; i < end; ++i) {
+        const fastring &data = ops[i].block->data;
+        if (data.empty())
+            continue;
+        _fx->seek(ops[i].offset);
+        size_t written = 0;
+        while (written < data.size()) {
+            size_t n = _fx->write(data.data() + written, data.size() - written);
+            if (n == 0) {
+                ELOG << "write file failed: " << _path;
+                return false;
+            }
+            written += n;
+        }
+    }
+    return true;
+}
+
+bool WriteBack::openFile(const fastring &path)
+{
+    fs::mkdir(path::dir(path), true);   // 创建文件保存的根/子目录
+    _fx = new fs::file(path, 'm');
+    if (!_fx->exists()) {
+        ELOG << "file create error, file = " << path;
+        delete _fx;
+        _fx = nullptr;
+        return false;
+    }
+    _path = path;
+    return true;
+}
+
+void WriteBack::closeFile()
+{
+    if (_fx == nullptr)
+        return;
+    _fx->close();
+    delete _fx;
+    _fx = nullptr;
+    _path.clear();
+}
+#endif
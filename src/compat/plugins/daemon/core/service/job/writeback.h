@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef WRITEBACK_H
+#define WRITEBACK_H
+
+#include "service/comshare.h"
+#include "co/co.h"
+#include "co/fs.h"
+
+#include <QSharedPointer>
+#include <atomic>
+#include <deque>
+#include <thread>
+
+// The write-back stage of a receive job. The blocks are queued with their file and offset and
+// written by a dedicated thread, so neither the rpc handler nor the job loop waits for the disk.
+// The adjacent blocks of a file are merged into one vectored write and the file is preallocated
+// ahead of the writing on linux. A failure is reported by the next write or flush.
+class WriteBack
+{
+public:
+    // capacity: the max bytes queued, write() waits above it
+    explicit WriteBack(int64 capacity);
+    ~WriteBack();
+
+    // queue the block at offset of the file, the flags of FIlE_CREATE and FILE_CLOSE open and
+    // close the file. The block (and its pooled buffer) is released after written.
+    bool write(const fastring &path, int64 offset, const QSharedPointer<FSDataBlock> &block);
+    // wait until all queued blocks are written, return false if any failed.
+    bool flush();
+    // drop the queued blocks, close the file and stop the thread.
+    void stop();
+
+private:
+    struct WriteOp {
+        fastring path;
+        int64 offset { 0 };
+        QSharedPointer<FSDataBlock> block;
+    };
+
+    void run();
+    void writeOps(std::deque<WriteOp> &ops);
+    bool writeRun(const std::deque<WriteOp> &ops, size_t begin, size_t end);
+    bool openFile(const fastring &path);
+    void closeFile();
+
+    co::mutex _mutex;
+    std::deque<WriteOp> _ops;
+    int64 _bytes { 0 }; // queued or being written
+    int _pending { 0 }; // the ops queued or being written
+    int64 _capacity;
+    co::event _ready; // ops queued or stopped
+    co::event _drained; // a batch written
+    std::atomic_bool _failed { false };
+    std::atomic_bool _stoped { false };
+    std::thread _thread;
+
+    // only used by the writer thread
+    fastring _path;
+#ifdef linux
+    int _fd { -1 };
+    int64 _reserved { 0 }; // preallocated up to
+#else
+    fs::file *_fx { nullptr };
+#endif
+};
+
+#endif // WRITEBACK_H
@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "jobmanager.h"
+#include "job/blockframe.h"
+#include "job/blockpool.h"
 #include "common/constant.h"
 #include "ipc/proto/backend.h"
 #include "ipc/bridge.h"
@@ -119,11 +121,43 @@ bool JobManager::doJobAction(const uint action, const int jobid)
     return result;
 }
 
-bool JobManager::handleFSData(const co::Json &info, fastring buf, FileTransResponse *reply)
+bool JobManager::handleFSData(const co::Json &info, const fastring &buf, FileTransResponse *reply)
 {
-    QSharedPointer<FSDataBlock> datablock(new FSDataBlock);
+    QSharedPointer<FSDataBlock> datablock = BlockPool::instance()->take(buf.size());
     datablock->from_json(info);
-    datablock->data = buf;
+    datablock->data.assign(buf.data(), buf.size());
+    return pushFSData(datablock, reply);
+}
+
+bool JobManager::handleFSBlock(const fastring &frame, FileTransResponse *reply)
+{
+    BlockFrame header;
+    if (!header.decode(frame.data(), frame.size())) {
+        ELOG << "broken block frame, size: " << frame.size();
+        return false;
+    }
+
+    QSharedPointer<TransferJob> job { nullptr };
+    {
+        QReadLocker lk(&g_m);
+        job = _transjob_recvs.value(header.job_id);
+    }
+    if (job.isNull())
+        return false;
+
+    QSharedPointer<FSDataBlock> datablock = BlockPool::instance()->take(static_cast<size_t>(header.length));
+    datablock->job_id = header.job_id;
+    datablock->file_id = header.file_id;
+    datablock->filename = job->frameName(header.name, header.name_len);
+    datablock->blk_id = header.blk_id;
+    datablock->flags = header.flags;
+    datablock->data_size = header.data_size;
+    datablock->data.assign(header.payload, static_cast<size_t>(header.length));
+    return pushFSData(datablock, reply);
+}
+
+bool JobManager::pushFSData(const QSharedPointer<FSDataBlock> &datablock, FileTransResponse *reply)
+{
     int32 jobId = datablock->job_id;
 
     if (reply) {
@@ -138,6 +172,11 @@ bool JobManager::handleFSData(const co::Json &info, fastring buf, FileTransRespo
 
     if (!job.isNull()) {
         job->pushQueque(datablock);
+        if (reply) {
+            // the sender slows down by the blocks waiting to write
+            reply->blk_id = datablock->blk_id;
+            reply->queue = job->queueCount();
+        }
         if (datablock->flags & JobTransFileOp::FILE_COUNTED && job->freeBytes() < datablock->data_size) {
             return false;
         } else if (datablock->flags & JobTransFileOp::FIlE_DIR_CREATE || datablock->flags & JobTransFileOp::FIlE_CREATE) {
@@ -24,7 +24,9 @@ public:
 public slots:
     bool handleRemoteRequestJob(QString json, QString *targetAppName);
     bool doJobAction(const uint action, const int jobid);
-    bool handleFSData(const co::Json &info, fastring buf, FileTransResponse *reply);
+    bool handleFSData(const co::Json &info, const fastring &buf, FileTransResponse *reply);
+    // the block in binrary frame, see blockframe.h
+    bool handleFSBlock(const fastring &frame, FileTransResponse *reply);
     bool handleCancelJob(co::Json &info, FileTransResponse *reply);
     bool handleTransReport(co::Json &info, FileTransResponse *reply);
 
@@ -34,6 +36,7 @@ public slots:
     void handleOtherOffline(const QString &ip);
 private:
     explicit JobManager(QObject *parent = nullptr);
+    bool pushFSData(const QSharedPointer<FSDataBlock> &datablock, FileTransResponse *reply);
 
 private:
     QMap<int, QSharedPointer<TransferJob>> _transjob_sends;
@@ -185,7 +185,7 @@ void HandleRpcService::handleRemoteDisc(co::Json &info)
     SendIpcService::instance()->handleSendToClient(targetAppname, MISC_MSG, jsonData);
 }
 
-void HandleRpcService::handleRemoteFileBlock(co::Json &info, fastring data)
+void HandleRpcService::handleRemoteFileBlock(co::Json &info, const fastring &data)
 {
     FileTransResponse reply;
     auto res = JobManager::instance()->handleFSData(info, data, &reply);
@@ -197,6 +197,18 @@ void HandleRpcService::handleRemoteFileBlock(co::Json &info, fastring data)
     _outgo_chan << out;
 }
 
+void HandleRpcService::handleRemoteFileFrame(const fastring &frame)
+{
+    FileTransResponse reply;
+    auto res = JobManager::instance()->handleFSBlock(frame, &reply);
+
+    OutData out;
+    out.type = FS_BLOCK;
+    reply.result = (res ? OK : IO_ERROR);
+    out.json = reply.as_json().str();
+    _outgo_chan << out;
+}
+
 void HandleRpcService::handleRemoteReport(co::Json &info)
 {
     FileTransResponse reply;
@@ -239,6 +251,7 @@ void HandleRpcService::handleTransJob(co::Json &info)
 
     FileTransResponse reply;
     reply.result = (res ? OK : IO_ERROR);
+    reply.feature = TRANS_FEATURE_BLOCK_FRAME;
 
     OutData data;
     data.type = TRANSJOB;
@@ -502,6 +515,11 @@ void HandleRpcService::startRemoteServer(const quint16 port)
                 continue;
             }
             LOG_IF(FLG_log_detail) << ">> get chan value: " << indata.type << " json:" << indata.json;
+            if (indata.type == FS_BLOCK) {
+                // the binrary frame has no json
+                self->handleRemoteFileFrame(indata.buf);
+                continue;
+            }
             co::Json json_obj = json::parse(indata.json);
             if (json_obj.is_null()) {
                 ELOG << "parse error from: " << indata.json;
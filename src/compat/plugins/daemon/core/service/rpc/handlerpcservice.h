@@ -29,7 +29,8 @@ public:
     bool handleRemoteApplyTransFile(co::Json &info);
     bool handleRemoteLogin(co::Json &info);
     void handleRemoteDisc(co::Json &info);
-    void handleRemoteFileBlock(co::Json &info, fastring data);
+    void handleRemoteFileBlock(co::Json &info, const fastring &data);
+    void handleRemoteFileFrame(const fastring &frame);
     void handleRemoteReport(co::Json &info);
     void handleRemoteJobCancel(co::Json &info);
     void handleTransJob(co::Json &info);
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <google/protobuf/service.h>
+#include <google/protobuf/descriptor.h>
 #include <sstream>
 #include <atomic>
 #include <QThread>
@@ -41,17 +42,18 @@ void RemoteServiceImpl::proto_msg(google::protobuf::RpcController *controller,
     IncomeData in;
     in.type = static_cast<ChanType>(request->type());
     in.json = request->msg();
-    std::string buffer = request->data();
-    in.buf = buffer;
-    _income_chan << in;
+    in.buf = fastring(request->data().data(), request->data().size());
+    // move the block data into chan, it may be large
+    const ChanType type = in.type;
+    _income_chan << std::move(in);
 
     OutData out;
     _outgo_chan >> out;
-    if (in.type != out.type) {
-        WLOG << "RPC response not match type:" << in.type << " != " << out.type;
+    if (type != out.type) {
+        WLOG << "RPC response not match type:" << type << " != " << out.type;
         // skip this, try next data
         _outgo_chan >> out;
-        if (in.type != out.type) return;
+        if (type != out.type) return;
     }
     response->set_type(out.type);
     response->set_msg(out.json.c_str());
@@ -80,6 +82,11 @@ RemoteServiceSender::~RemoteServiceSender()
 }
 
 SendResult RemoteServiceSender::doSendProtoMsg(const uint32 type, const QString &msg, const QByteArray &data)
+{
+    return doSendProtoMsg(type, msg, std::string(data.constData(), static_cast<size_t>(data.size())));
+}
+
+SendResult RemoteServiceSender::doSendProtoMsg(const uint32 type, const QString &msg, std::string data)
 {
     DLOG_IF(FLG_log_detail) << "send to remote = " << type << " = " << msg.toStdString() << "\n ip = "
          << _target_ip.toStdString() << " : port = " << _target_port;
@@ -101,13 +108,15 @@ SendResult RemoteServiceSender::doSendProtoMsg(const uint32 type, const QString
     }
 
     RemoteService_Stub stub(_executor_p->chan());
-    zrpc_ns::ZRpcController *rpc_controller = _executor_p->control();
+    // every call has its own controller, the calls on one channel can run at the same time
+    zrpc_ns::ZRpcController controller;
+    controller.SetTimeout(_executor_p->control()->Timeout());
+    zrpc_ns::ZRpcController *rpc_controller = &controller;
 
     ProtoData req, rpc_res;
     req.set_type(type);
     req.set_msg(msg.toStdString());
-    fastring dt(data.toStdString().c_str(), static_cast<size_t>(data.size()));
-    req.set_data(dt.c_str(), dt.size());
+    req.set_data(std::move(data));
 
 #if defined(WIN32)
     co::wait_group wg;
@@ -138,6 +147,112 @@ SendResult RemoteServiceSender::doSendProtoMsg(const uint32 type, const QString
     return res;
 }
 
+SendResult RemoteServiceSender::sendProtoMsgAsync(const uint32 type, const QString &msg, std::string data, std::string *seq)
+{
+    SendResult res;
+    res.protocolType = type;
+    // only the long connection can take the replies later
+    QSharedPointer<ZRpcClientExecutor> _executor_p{nullptr};
+    if (isTrans)
+        _executor_p = createTransExecutor();
+    if (_executor_p.isNull()) {
+        res.errorType = PARAM_ERROR;
+        res.data = "sendProtoMsgAsync ERROR: no trans executor";
+        ELOG << "sendProtoMsgAsync ERROR: no trans executor";
+        return res;
+    }
+
+    zrpc_ns::ZRpcChannel *channel = _executor_p->chan();
+    zrpc_ns::ZRpcController controller;
+    controller.SetTimeout(_executor_p->control()->Timeout());
+    zrpc_ns::ZRpcController *rpc_controller = &controller;
+    const google::protobuf::MethodDescriptor *method = RemoteService::descriptor()->FindMethodByName("proto_msg");
+
+    ProtoData req;
+    req.set_type(type);
+    req.set_msg(msg.toStdString());
+    req.set_data(std::move(data));
+
+    std::string msg_req;
+#if defined(WIN32)
+    co::wait_group wg;
+    wg.add(1);
+    auto s = co::next_sched();
+    s->go([&channel, &method, &rpc_controller, &req, &msg_req, wg]() {
+#endif
+    msg_req = channel->sendMethod(method, rpc_controller, &req);
+#if defined(WIN32)
+        wg.done();
+    });
+    wg.wait();
+#endif
+
+    if (msg_req.empty()) {
+        res.errorType = INVOKE_FAIL;
+        ELOG << "Failed to send server, error code: " << rpc_controller->ErrorCode()
+            << ", error info: " << rpc_controller->ErrorText();
+        res.data = _target_ip.toStdString();
+        clearExecutor();
+        clearLongExecutor();
+        return res;
+    }
+
+    if (seq)
+        *seq = msg_req;
+    res.errorType = INVOKE_OK;
+    return res;
+}
+
+SendResult RemoteServiceSender::waitProtoReply(const uint32 type, const std::string &seq)
+{
+    SendResult res;
+    res.protocolType = type;
+    QSharedPointer<ZRpcClientExecutor> _executor_p{nullptr};
+    if (isTrans)
+        _executor_p = createTransExecutor();
+    if (_executor_p.isNull()) {
+        res.errorType = PARAM_ERROR;
+        res.data = "waitProtoReply ERROR: no trans executor";
+        ELOG << "waitProtoReply ERROR: no trans executor";
+        return res;
+    }
+
+    zrpc_ns::ZRpcChannel *channel = _executor_p->chan();
+    zrpc_ns::ZRpcController controller;
+    controller.SetTimeout(_executor_p->control()->Timeout());
+    zrpc_ns::ZRpcController *rpc_controller = &controller;
+
+    ProtoData rpc_res;
+    bool ok = false;
+#if defined(WIN32)
+    co::wait_group wg;
+    wg.add(1);
+    auto s = co::next_sched();
+    s->go([&channel, &seq, &rpc_controller, &rpc_res, &ok, wg]() {
+#endif
+    ok = channel->recvMethod(seq, rpc_controller, &rpc_res);
+#if defined(WIN32)
+        wg.done();
+    });
+    wg.wait();
+#endif
+
+    if (!ok) {
+        res.errorType = INVOKE_FAIL;
+        ELOG << "Failed to wait server reply, error code: " << rpc_controller->ErrorCode()
+            << ", error info: " << rpc_controller->ErrorText();
+        res.data = _target_ip.toStdString();
+        clearExecutor();
+        clearLongExecutor();
+        return res;
+    }
+
+    res.errorType = INVOKE_OK;
+    res.data = rpc_res.msg();
+    DLOG_IF(FLG_log_detail) << "response body: " << rpc_res.ShortDebugString() << "\n" << res.as_json();
+    return res;
+}
+
 void RemoteServiceSender::clearExecutor()
 {
     QWriteLocker lk(&_executor_lock);
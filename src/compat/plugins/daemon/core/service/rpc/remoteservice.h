@@ -71,6 +71,12 @@ public:
     ~RemoteServiceSender();
 
     SendResult doSendProtoMsg(const uint32 type, const QString &msg, const QByteArray &data);
+    // the data is moved into the request without copy
+    SendResult doSendProtoMsg(const uint32 type, const QString &msg, std::string data);
+    // pipelined send on the trans connection: return at once with the seq of request,
+    // then wait its reply by waitProtoReply, the replies can be taken in any order.
+    SendResult sendProtoMsgAsync(const uint32 type, const QString &msg, std::string data, std::string *seq);
+    SendResult waitProtoReply(const uint32 type, const std::string &seq);
     void clearExecutor();
     void remoteIP(const QString &session, QString *ip, uint16 *port);
     void setIpInfo(const QString &ip, const uint16 port);
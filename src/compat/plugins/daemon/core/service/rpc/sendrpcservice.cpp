@@ -104,6 +104,9 @@ void SendRpcWork::handlePing(const QStringList apps)
     for (const auto &appName : apps) {
         if (_stoped)
             return;
+        // the last ping is still waiting its reply
+        if (_pinging.contains(appName))
+            continue;
         auto sender = this->rpcSender(appName);
         if (sender.isNull())
             continue;
@@ -113,25 +116,41 @@ void SendRpcWork::handlePing(const QStringList apps)
         ping.tarAppname = sender->targetAppname().toStdString();
         ping.ip = Util::getFirstIp();
 
-        SendResult rs = sender->doSendProtoMsg(RPC_PING, ping.as_json().str().c_str(), QByteArray());
-        if (rs.data.empty() || rs.errorType < INVOKE_OK) {
-            DLOG << "remote server no reply ping !!!!! " << appName.toStdString();
-            auto count = _ping_failed_count.take(appName);
-            if (count > 2) {
-                // 通知客户端ping超时
-                ELOG << "timeout: server no reply ping: " << count;
-                fastring msg = co::Json({{"app", appName.toStdString()}, {"offline", true}}).str();
-                SendIpcService::instance()->preprocessOfflineStatus(appName, PING_FAILED, msg);
-                SendRpcService::instance()->removePing(appName);
-            } else {
-                _ping_failed_count.insert(appName, ++count);
-            }
+        // 心跳不在工作线程里排队，避免被控制消息阻塞
+        _pinging.insert(appName);
+        QString msg = ping.as_json().str().c_str();
+        UNIGO([this, sender, appName, msg]() {
+            SendResult rs = sender->doSendProtoMsg(RPC_PING, msg, QByteArray());
+            bool ok = !rs.data.empty() && rs.errorType >= INVOKE_OK;
+            QMetaObject::invokeMethod(this, "handlePingResult", Qt::QueuedConnection,
+                                      Q_ARG(QString, appName), Q_ARG(bool, ok));
+        });
+    }
+}
+
+void SendRpcWork::handlePingResult(const QString appName, bool ok)
+{
+    _pinging.remove(appName);
+    if (_stoped)
+        return;
+
+    if (!ok) {
+        DLOG << "remote server no reply ping !!!!! " << appName.toStdString();
+        auto count = _ping_failed_count.take(appName);
+        if (count > 2) {
+            // 通知客户端ping超时
+            ELOG << "timeout: server no reply ping: " << count;
+            fastring msg = co::Json({{"app", appName.toStdString()}, {"offline", true}}).str();
+            SendIpcService::instance()->preprocessOfflineStatus(appName, PING_FAILED, msg);
+            SendRpcService::instance()->removePing(appName);
         } else {
-            // 取消离线预处理消息
-            SendIpcService::instance()->cancelOfflineStatus(appName);
-            _ping_failed_count.remove(appName);
-            _ping_failed_count.insert(appName, 0);
+            _ping_failed_count.insert(appName, ++count);
         }
+    } else {
+        // 取消离线预处理消息
+        SendIpcService::instance()->cancelOfflineStatus(appName);
+        _ping_failed_count.remove(appName);
+        _ping_failed_count.insert(appName, 0);
     }
 }
 
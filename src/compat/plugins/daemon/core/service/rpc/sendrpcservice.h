@@ -13,6 +13,7 @@
 #include <QReadLocker>
 #include <QThread>
 #include <QSharedPointer>
+#include <QSet>
 
 #include "co/json.h"
 
@@ -37,6 +38,7 @@ private slots:
                               const QString msg, const QByteArray data);
 
     void handlePing(const QStringList apps);
+    void handlePingResult(const QString appName, bool ok);
 
 private:
     QSharedPointer<RemoteServiceSender> createRpcSender(const QString &appName,
@@ -51,6 +53,8 @@ private:
     std::atomic_bool _stoped{false};
 
     QMap<QString, int> _ping_failed_count;
+    // the apps whose ping is in flight
+    QSet<QString> _pinging;
 };
 
 class SendRpcService : public QObject
@@ -0,0 +1,230 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef BLOCKHASH_H
+#define BLOCKHASH_H
+
+#include <stdint.h>
+#include <string.h>
+
+// the content hash of the file block: xxHash64, compare the blocks between both sides.
+namespace BlockHash {
+
+static const uint64_t PRIME1 = 11400714785074694791ULL;
+static const uint64_t PRIME2 = 14029467366897019727ULL;
+static const uint64_t PRIME3 = 1609587929392839161ULL;
+static const uint64_t PRIME4 = 9650029242287828579ULL;
+static const uint64_t PRIME5 = 2870177450012600261ULL;
+
+inline uint64_t rotl(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const uint8_t *p)
+{
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; --i)
+        v = (v << 8) | p[i];
+    return v;
+}
+
+inline uint32_t read32(const uint8_t *p)
+{
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+            | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+inline uint64_t round(uint64_t acc, uint64_t input)
+{
+    acc += input * PRIME2;
+    acc = rotl(acc, 31);
+    return acc * PRIME1;
+}
+
+inline uint64_t merge(uint64_t acc, uint64_t val)
+{
+    acc ^= round(0, val);
+    return acc * PRIME1 + PRIME4;
+}
+
+inline uint64_t hash(const void *data, size_t size, uint64_t seed = 0)
+{
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    const uint8_t *end = p + size;
+    uint64_t h = 0;
+
+    if (size >= 32) {
+        uint64_t v1 = seed + PRIME1 + PRIME2;
+        uint64_t v2 = seed + PRIME2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - PRIME1;
+        const uint8_t *limit = end - 32;
+        do {
+            v1 = round(v1, read64(p));
+            v2 = round(v2, read64(p + 8));
+            v3 = round(v3, read64(p + 16));
+            v4 = round(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = merge(h, v1);
+        h = merge(h, v2);
+        h = merge(h, v3);
+        h = merge(h, v4);
+    } else {
+        h = seed + PRIME5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    while (p + 8 <= end) {
+        h ^= round(0, read64(p));
+        h = rotl(h, 27) * PRIME1 + PRIME4;
+        p += 8;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * PRIME1;
+        h = rotl(h, 23) * PRIME2 + PRIME3;
+        p += 4;
+    }
+    while (p < end) {
+        h ^= (*p) * PRIME5;
+        h = rotl(h, 11) * PRIME1;
+        ++p;
+    }
+
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME3;
+    h ^= h >> 32;
+    return h;
+}
+
+// the streaming one, same result as hash() of the whole data
+class Hasher
+{
+public:
+    explicit Hasher(uint64_t seed = 0)
+    {
+        reset(seed);
+    }
+
+    void reset(uint64_t seed = 0)
+    {
+        _seed = seed;
+        _v1 = seed + PRIME1 + PRIME2;
+        _v2 = seed + PRIME2;
+        _v3 = seed;
+        _v4 = seed - PRIME1;
+        _total = 0;
+        _memsize = 0;
+    }
+
+    void update(const void *data, size_t size)
+    {
+        const uint8_t *p = static_cast<const uint8_t *>(data);
+        const uint8_t *end = p + size;
+        _total += size;
+
+        if (_memsize + size < 32) {
+            memcpy(_mem + _memsize, p, size);
+            _memsize += size;
+            return;
+        }
+
+        if (_memsize > 0) {
+            size_t fill = 32 - _memsize;
+            memcpy(_mem + _memsize, p, fill);
+            consume(_mem);
+            p += fill;
+            _memsize = 0;
+        }
+
+        while (p + 32 <= end) {
+            consume(p);
+            p += 32;
+        }
+
+        _memsize = static_cast<size_t>(end - p);
+        memcpy(_mem, p, _memsize);
+    }
+
+    uint64_t digest() const
+    {
+        uint64_t h = 0;
+        if (_total >= 32) {
+            h = rotl(_v1, 1) + rotl(_v2, 7) + rotl(_v3, 12) + rotl(_v4, 18);
+            h = merge(h, _v1);
+            h = merge(h, _v2);
+            h = merge(h, _v3);
+            h = merge(h, _v4);
+        } else {
+            h = _seed + PRIME5;
+        }
+
+        h += _total;
+
+        const uint8_t *p = _mem;
+        const uint8_t *end = _mem + _memsize;
+        while (p + 8 <= end) {
+            h ^= round(0, read64(p));
+            h = rotl(h, 27) * PRIME1 + PRIME4;
+            p += 8;
+        }
+        if (p + 4 <= end) {
+            h ^= static_cast<uint64_t>(read32(p)) * PRIME1;
+            h = rotl(h, 23) * PRIME2 + PRIME3;
+            p += 4;
+        }
+        while (p < end) {
+            h ^= (*p) * PRIME5;
+            h = rotl(h, 11) * PRIME1;
+            ++p;
+        }
+
+        h ^= h >> 33;
+        h *= PRIME2;
+        h ^= h >> 29;
+        h *= PRIME3;
+        h ^= h >> 32;
+        return h;
+    }
+
+private:
+    void consume(const uint8_t *p)
+    {
+        _v1 = round(_v1, read64(p));
+        _v2 = round(_v2, read64(p + 8));
+        _v3 = round(_v3, read64(p + 16));
+        _v4 = round(_v4, read64(p + 24));
+    }
+
+    uint64_t _seed { 0 };
+    uint64_t _v1 { 0 };
+    uint64_t _v2 { 0 };
+    uint64_t _v3 { 0 };
+    uint64_t _v4 { 0 };
+    uint64_t _total { 0 };
+    uint8_t _mem[32];
+    size_t _memsize { 0 };
+};
+
+// the hash list is sent as little endian uint64 one by one
+inline void encode(uint64_t value, char *out)
+{
+    for (int i = 0; i < 8; ++i)
+        out[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+}
+
+inline uint64_t decode(const char *in)
+{
+    return read64(reinterpret_cast<const uint8_t *>(in));
+}
+
+} // namespace BlockHash
+
+#endif // BLOCKHASH_H
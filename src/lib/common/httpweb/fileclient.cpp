@@ -4,14 +4,24 @@
 
 #include "fileclient.h"
 #include "tokencache.h"
+#include "blockhash.h"
+#include "webcompress.h"
 
 #include "filesystem/file.h"
 #include "filesystem/path.h"
 #include "filesystem/directory.h"
 
 #include "server/http/https_client.h"
+#include "session/sslsessioncache.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <unordered_set>
+
+// the longest line of the chunked body: the chunk size or a trailer
+#define CHUNK_LINE_MAX 1024
 
 using CppServer::HTTP::HTTPRequest;
 using CppServer::HTTP::HTTPResponse;
@@ -23,22 +33,70 @@ public:
 
     void setResponseHandler(ResponseHandler cb)
     {
+        std::lock_guard<std::mutex> locker(_handler_lock);
         _handler = std::move(cb);
-        // Must sleep for release something, or it will be blocked in request
-        CppCommon::Thread::Yield();
-        CppCommon::Thread::Sleep(1);
+        _canceled = false;
+        _finished = false;
+        _active = std::chrono::steady_clock::now();
+    }
+
+    // wait for the response done, or no data arrived in the idle timeout (ms).
+    // return true if the response has been finished or canceled by the handler.
+    bool waitFinished(const std::atomic<bool> &stop, int64_t timeout)
+    {
+        auto idle = std::chrono::milliseconds(timeout);
+        std::unique_lock<std::mutex> locker(_handler_lock);
+        while (!_finished && !stop.load()) {
+            auto deadline = _active + idle;
+            if (std::chrono::steady_clock::now() >= deadline) {
+                std::cout << "Response timeout, no data arrived!" << std::endl;
+                return false;
+            }
+            _finish_cond.wait_until(locker, deadline);
+        }
+        return _finished;
+    }
+
+    // the body of current response is compressed
+    bool deflated() const
+    {
+        return _deflated;
     }
 
 protected:
     void onConnected() override
     {
+        // the parallel and the later connections of the transfer resume the first one's session
+        SSLSessionCache::instance()->resume(stream().native_handle(), address(), port());
+
         // must invoke supper fun, or cause canot connect server.
         HTTPSClientEx::onConnected();
     }
 
     void onDisconnected() override
     {
+        // broken off before the last chunk
+        if (_chunked.exchange(false) && !_canceled) {
+            std::cout << "Response broken off before the last chunk!" << std::endl;
+            invoke(RES_ERROR, nullptr, 0);
+        }
+
         HTTPSClientEx::onDisconnected();
+
+        // wake up the waiting one, no more data will arrive
+        std::lock_guard<std::mutex> locker(_handler_lock);
+        markFinished();
+    }
+
+    void onReceived(const void *buffer, size_t size) override
+    {
+        // the response does not parse the chunked body, decode it here
+        if (_chunked) {
+            receiveChunks(static_cast<const char *>(buffer), size);
+            return;
+        }
+
+        HTTPSClientEx::onReceived(buffer, size);
     }
 
     void onReceivedResponseHeader(const HTTPResponse &response) override
@@ -49,15 +107,44 @@ protected:
 //        std::cout << "Response header Content: \n" << response.string() << std::endl;
 //        std::cout << "------------------" << std::endl;
 
-        if (_handler) {
+        if (hasHandler()) {
             // get body by stream, so mark response arrived.
             HTTPSClientEx::onReceivedResponse(response);
 
-            if (_handler(response.status() == 200 ? RES_OKHEADER : RES_NOTFOUND, response.string().data(), response.body_length())) {
+            _deflated = false;
+            bool chunked = false;
+            for (size_t i = 0; i < response.headers(); ++i) {
+                auto header = response.header(i);
+                if (std::get<0>(header) == "Content-Encoding" && std::get<1>(header) == COMPRESS_ENCODING)
+                    _deflated = true;
+                if (std::get<0>(header) == "Transfer-Encoding" && std::get<1>(header) == "chunked")
+                    chunked = true;
+            }
+
+            bool ok = response.status() == 200 || response.status() == 206;
+            if (invoke(ok ? RES_OKHEADER : RES_NOTFOUND, response.string().data(), response.body_length())) {
                 // cancel
                 DisconnectAsync();
+            } else {
+                // e.g. the manifest, it is sent while the server walking
+                _chunked = ok && chunked;
+                _chunk_state = CHUNK_SIZE;
+                _chunk_line.clear();
+                if (ok && !response.body().empty()) {
+                    // the beginning of body may arrive with its header, do not lose it
+                    std::string body(response.body());
+                    if (_chunked) {
+                        receiveChunks(body.data(), body.size());
+                    } else if (invoke(RES_BODY, body.data(), body.size())) {
+                        _canceled = true;
+                        DisconnectAsync();
+                    }
+                }
             }
             _response.ClearCache();
+            // the rest body is taken in onReceived
+            if (_chunked)
+                _response.Clear();
         }
     }
 
@@ -68,13 +155,11 @@ protected:
         if (_canceled)
             return;
 
-        if (_handler) {
+        if (hasHandler()) {
             std::string cache = response.cache();
             size_t size = cache.size();
-            if (_handler(RES_FINISH, cache.data(), size)) {
-                // cancel
-                DisconnectAsync();
-            }
+            // the result only marks this file done, it is not a cancel.
+            invoke(RES_FINISH, cache.data(), size);
             _response.Clear();
             // donot disconnect at here, this connection may be continue to downlad other.
         } else {
@@ -85,10 +170,13 @@ protected:
     bool onReceivedResponseBody(const HTTPResponse &response) override
     {
        // std::cout << "Response BODY cache: " << response.cache().size() << std::endl;
-        if (_handler) {
+        if (_chunked)
+            return true;
+
+        if (hasHandler()) {
             std::string cache = response.cache();
             size_t size = cache.size();
-            if (_handler(RES_BODY, cache.data(), size)) {
+            if (invoke(RES_BODY, cache.data(), size)) {
                 _canceled = true;
                 // cancel
                 DisconnectAsync();
@@ -102,17 +190,228 @@ protected:
     void onReceivedResponseError(const HTTPResponse &response, const std::string &error) override
     {
         std::cout << "Response error: " << error << std::endl;
-        if (_handler) {
-            _handler(RES_ERROR, nullptr, 0);
+        if (hasHandler()) {
+            invoke(RES_ERROR, nullptr, 0);
         }
     }
 
 private:
+    bool hasHandler()
+    {
+        std::lock_guard<std::mutex> locker(_handler_lock);
+        return _handler != nullptr;
+    }
+
+    // call the handler and mark done if it is the end, return true if should cancel
+    bool invoke(int status, const char *buffer, size_t size)
+    {
+        std::lock_guard<std::mutex> locker(_handler_lock);
+        if (!_handler)
+            return false;
+
+        _active = std::chrono::steady_clock::now();
+        bool exit = _handler(status, buffer, size);
+        if (exit || status == RES_FINISH || status == RES_ERROR)
+            markFinished();
+        return exit;
+    }
+
+    // must be called with the handler lock
+    void markFinished()
+    {
+        _finished = true;
+        _finish_cond.notify_all();
+    }
+
+    // pass the data of the chunks to the handler, the last chunk finishes the response
+    void receiveChunks(const char *data, size_t size)
+    {
+        size_t pos = 0;
+        while (pos < size && _chunked && !_canceled) {
+            if (_chunk_state == CHUNK_DATA) {
+                size_t num = std::min<size_t>(_chunk_left, size - pos);
+                if (invoke(RES_BODY, data + pos, num)) {
+                    _canceled = true;
+                    DisconnectAsync();
+                    return;
+                }
+                pos += num;
+                _chunk_left -= num;
+                if (_chunk_left == 0)
+                    _chunk_state = CHUNK_DATA_END;
+                continue;
+            }
+
+            // the size line, the line after the data or the trailer
+            const char *begin = data + pos;
+            auto end = static_cast<const char *>(memchr(begin, '\n', size - pos));
+            size_t num = end ? static_cast<size_t>(end - begin) + 1 : size - pos;
+            _chunk_line.append(begin, num);
+            pos += num;
+            if (!end) {
+                if (_chunk_line.size() > CHUNK_LINE_MAX)
+                    failChunks();
+                continue;
+            }
+
+            std::string line;
+            line.swap(_chunk_line);
+            while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
+                line.pop_back();
+
+            if (_chunk_state == CHUNK_SIZE) {
+                char *last = nullptr;
+                unsigned long long length = strtoull(line.c_str(), &last, 16);
+                if (last == line.c_str()) {
+                    failChunks();
+                    return;
+                }
+                _chunk_left = static_cast<size_t>(length);
+                _chunk_state = length > 0 ? CHUNK_DATA : CHUNK_TRAILER;
+            } else if (_chunk_state == CHUNK_DATA_END) {
+                if (!line.empty()) {
+                    failChunks();
+                    return;
+                }
+                _chunk_state = CHUNK_SIZE;
+            } else if (line.empty()) {
+                // the empty line after the last chunk, all has arrived
+                _chunked = false;
+                invoke(RES_FINISH, nullptr, 0);
+                return;
+            }
+        }
+    }
+
+    void failChunks()
+    {
+        std::cout << "Response invalid chunk!" << std::endl;
+        _chunked = false;
+        invoke(RES_ERROR, nullptr, 0);
+        DisconnectAsync();
+    }
+
     ResponseHandler _handler { nullptr };
     std::atomic<bool> _canceled { false };
+    std::atomic<bool> _deflated { false };
+    // the current response is chunked, it is decoded in the io thread
+    enum ChunkState {
+        CHUNK_SIZE,
+        CHUNK_DATA,
+        CHUNK_DATA_END,
+        CHUNK_TRAILER,
+    };
+    std::atomic<bool> _chunked { false };
+    ChunkState _chunk_state { CHUNK_SIZE };
+    // the incomplete line
+    std::string _chunk_line;
+    size_t _chunk_left { 0 };
+
+    std::mutex _handler_lock;
+    std::condition_variable _finish_cond;
+    std::chrono::steady_clock::time_point _active;
+    bool _finished { false };
+};
+
+// One data connection with its own work queue, download files one by one.
+class DownloadChannel
+{
+public:
+    DownloadChannel(FileClient *owner, const std::shared_ptr<HTTPFileClient> &client)
+        : _owner(owner)
+        , _client(client)
+    {
+        _thread = CppCommon::Thread::Start([this]() { run(); });
+    }
+
+    ~DownloadChannel()
+    {
+        {
+            std::lock_guard<std::mutex> locker(_lock);
+            _quit = true;
+        }
+        _cond.notify_one();
+        _client->DisconnectAsync();
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    void push(DownloadTask task)
+    {
+        std::lock_guard<std::mutex> locker(_lock);
+        _pending_bytes += task.length;
+        _tasks.push_back(std::move(task));
+        _cond.notify_one();
+    }
+
+    // drop all waiting tasks and break off the downloading one
+    void cancel()
+    {
+        {
+            std::lock_guard<std::mutex> locker(_lock);
+            _tasks.clear();
+            _pending_bytes = 0;
+        }
+        _client->DisconnectAsync();
+    }
+
+    // the bytes in queue and in downloading
+    uint64_t pendingBytes()
+    {
+        std::lock_guard<std::mutex> locker(_lock);
+        return _pending_bytes;
+    }
+
+    bool idle()
+    {
+        std::lock_guard<std::mutex> locker(_lock);
+        return _tasks.empty() && !_busy;
+    }
+
+private:
+    void run()
+    {
+        while (true) {
+            DownloadTask task;
+            {
+                std::unique_lock<std::mutex> locker(_lock);
+                _cond.wait(locker, [this]() { return _quit || !_tasks.empty(); });
+                if (_quit)
+                    break;
+
+                task = std::move(_tasks.front());
+                _tasks.pop_front();
+                _busy = true;
+            }
+
+            _owner->downloadFile(_client.get(), task);
+
+            {
+                std::lock_guard<std::mutex> locker(_lock);
+                _busy = false;
+                _pending_bytes -= std::min<uint64_t>(_pending_bytes, task.length);
+            }
+            _owner->notifyChannelIdle();
+        }
+    }
+
+    FileClient *_owner { nullptr };
+    std::shared_ptr<HTTPFileClient> _client { nullptr };
+    std::thread _thread;
+
+    std::mutex _lock;
+    std::condition_variable _cond;
+    std::deque<DownloadTask> _tasks;
+    uint64_t _pending_bytes { 0 };
+    bool _busy { false };
+    bool _quit { false };
 };
 
 FileClient::FileClient(const std::shared_ptr<CppServer::Asio::Service> &service, const std::shared_ptr<CppServer::Asio::SSLContext>& context, const std::string &address, int port)
+    : _service(service)
+    , _context(context)
+    , _address(address)
+    , _port(port)
 {
     if (_httpClient) {
         //discontect current one
@@ -120,10 +419,14 @@ FileClient::FileClient(const std::shared_ptr<CppServer::Asio::Service> &service,
     }
     // Create HTTP client if the current one is empty
     _httpClient = std::make_shared<HTTPFileClient>(service, context, address, port);
+    _httpClient->SetupNoDelay(true);
 }
 
 FileClient::~FileClient()
 {
+    _stop.store(true);
+    _channels.clear();
+
     if (_httpClient) {
         _httpClient->Disconnect();
         _httpClient = nullptr;
@@ -141,10 +444,24 @@ void FileClient::setConfig(const std::string &token, const std::string &savedir)
     _savedir = savedir;
 }
 
+void FileClient::setConnections(int count)
+{
+    _connections = std::max(1, count);
+}
+
+void FileClient::setIncremental(bool incremental)
+{
+    _incremental = incremental;
+}
+
 void FileClient::stop()
 {
     _stop.store(true);
     _httpClient->DisconnectAsync();
+    for (auto &channel : _channels) {
+        channel->cancel();
+    }
+    _idle_cond.notify_all();
     // Note: can not join this thread beause of it callback to main thread.
     // _download_thread.join();
 }
@@ -157,6 +474,7 @@ void FileClient::startFileDownload(const std::vector<std::string> &webnames)
     }
 
     _stop.store(false);
+    createChannels();
 
     _download_thread = CppCommon::Thread::Start([this, webnames]() { walkDownload(webnames); });
 }
@@ -234,31 +552,90 @@ std::string FileClient::getHeadKey(const std::string &headstrs, const std::strin
     return value;
 }
 
-// download the file by name
-// [GET]download/<name>&token
-bool FileClient::downloadFile(const std::string &name, const std::string &rename)
+// download the file or its stripe by name into the available save path
+// [GET]download/<name>&token&offset=xxx[&range=<start>-<end>]
+bool FileClient::downloadFile(HTTPFileClient *client, const DownloadTask &task)
 {
-    auto avaipath = createNextAvailableName(rename.empty() ? name : rename, true);
-    if (avaipath.empty()) {
-        //FS exception now
-        std::cout << "createNextAvailableName exception now! " << name << std::endl;
-        _callback->onWebChanged(WEB_IO_ERROR, "fs_exception");
-        return false;
-    }
+    if (!task.packs.empty())
+        return downloadPack(client, task);
+    if (task.delta)
+        return downloadDelta(client, task);
+    if (task.resume)
+        return downloadResume(client, task);
+    if (!task.compress && task.size >= COMPRESS_MIN_SIZE
+            && WebCompress::compressible(CppCommon::Path(task.name).extension().string()))
+        return downloadWindows(client, task);
 
     bool result = false;
     {
-        const int EXIT_COUNT = 5000; // timeout if no data arrived
-        std::atomic<int> timeout_done = 0;
-
         uint64_t current = 0, total = 0;
         uint64_t offset = 0;
+        bool finished = false;
 
-        auto tempFile = CppCommon::File(avaipath);
+        auto tempFile = CppCommon::File(task.savepath);
         //    offset = tempFile.size();
 
+        // commit the written data into journal every CHECKPOINT_SIZE, resume from them if broken.
+        bool checkpoint = _journal.isOpened();
+        BlockHash::Hasher hasher;
+        uint64_t committed = task.stripe ? task.offset : 0;
+        uint64_t pending = 0;
+        auto commitPending = [&]() {
+            if (!checkpoint || pending == 0)
+                return;
+            tempFile.Flush();
+            _journal.commit(task.savepath, committed, pending, hasher.digest());
+            committed += pending;
+            pending = 0;
+            hasher.reset();
+        };
+        auto storeData = [&](const void *data, size_t size) {
+            // 实现层已循环写全部
+            tempFile.Write(data, size);
+            if (!checkpoint)
+                return;
+            const char *p = static_cast<const char *>(data);
+            while (size > 0) {
+                size_t num = static_cast<size_t>(std::min<uint64_t>(size, CHECKPOINT_SIZE - pending));
+                hasher.update(p, num);
+                pending += num;
+                p += num;
+                size -= num;
+                if (pending == CHECKPOINT_SIZE)
+                    commitPending();
+            }
+        };
+
+        // inflate the compressed window while writing
+        bool inflating = false;
+        z_stream stream;
+        std::vector<Bytef> inflated;
+        auto writeBody = [&](const char *data, size_t size) -> size_t {
+            if (!inflating) {
+                storeData(data, size);
+                return size;
+            }
+
+            size_t written = 0;
+            stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+            stream.avail_in = static_cast<uInt>(size);
+            do {
+                stream.next_out = inflated.data();
+                stream.avail_out = static_cast<uInt>(inflated.size());
+                int ret = inflate(&stream, Z_NO_FLUSH);
+                if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR)
+                    throwex CppCommon::FileSystemException("Inflate the compressed data failed!").Attach(tempFile);
+
+                size_t have = inflated.size() - stream.avail_out;
+                storeData(inflated.data(), have);
+                written += have;
+                if (ret == Z_STREAM_END || (ret == Z_BUF_ERROR && have == 0))
+                    break;
+            } while (stream.avail_in > 0 || stream.avail_out == 0);
+            return written;
+        };
+
         ResponseHandler cb([&](int status, const char *buffer, size_t size) -> bool {
-            timeout_done.store(0); // reset when data arrived
             if (_stop.load()) {
                 std::cout << "has been canceled from outside!" << std::endl;
                 return true;
@@ -272,7 +649,7 @@ bool FileClient::downloadFile(const std::string &name, const std::string &rename
 
                 // error：not found
                 shouldExit = true;
-                _callback->onWebChanged(WEB_NOT_FOUND, "not_found");
+                notifyChanged(WEB_NOT_FOUND, "not_found");
             }
             break;
             case RES_OKHEADER: {
@@ -281,7 +658,11 @@ bool FileClient::downloadFile(const std::string &name, const std::string &rename
                 try {
                     CppCommon::Path file_path = tempFile.absolute().RemoveExtension();
 
-                    if (!tempFile.IsFileWriteOpened()) {
+                    if (!tempFile.IsFileWriteOpened() && task.stripe) {
+                        // the file has been preallocated, write into its own range
+                        tempFile.Open(false, true);
+                        tempFile.Seek(task.offset);
+                    } else if (!tempFile.IsFileWriteOpened()) {
                         size_t cur_off = 0;
                         if (tempFile.IsFileExists()) {
                             cur_off = tempFile.size();
@@ -293,12 +674,19 @@ bool FileClient::downloadFile(const std::string &name, const std::string &rename
                         tempFile.Seek(cur_off);
                     }
 
-                    total = size;
-                    _callback->onWebChanged(WEB_FILE_BEGIN, file_path.string(), total);
+                    total = task.stripe ? task.size : size;
+
+                    if (task.compress && client->deflated()) {
+                        memset(&stream, 0, sizeof(stream));
+                        inflating = inflateInit(&stream) == Z_OK;
+                        inflated.resize(STREAM_BLOCK_SIZE);
+                    }
+                    if (!task.stripe || !task.stripe->started.exchange(true))
+                        notifyChanged(WEB_FILE_BEGIN, file_path.string(), total);
                 } catch (const CppCommon::FileSystemException &ex) {
                     std::cout << "Header create throw FS exception: " << ex.message() << std::endl;
                     shouldExit = true;
-                    _callback->onWebChanged(WEB_IO_ERROR, "io_error");
+                    notifyChanged(WEB_IO_ERROR, "io_error");
                 }
             }
             break;
@@ -306,14 +694,13 @@ bool FileClient::downloadFile(const std::string &name, const std::string &rename
                 if (tempFile.IsFileWriteOpened() && buffer && size > 0) {
                     current += size;
                     try {
-                        // 实现层已循环写全部
-                        tempFile.Write(buffer, size);
+                        size_t written = writeBody(buffer, size);
 
-                        shouldExit = _callback->onProgress(size);
+                        shouldExit = notifyProgress(written);
                     } catch (const CppCommon::FileSystemException &ex) {
                         std::cout << "Write throw FS exception: " << ex.message() << std::endl;
                         shouldExit = true;
-                        _callback->onWebChanged(WEB_IO_ERROR, "io_error");
+                        notifyChanged(WEB_IO_ERROR, "io_error");
                     }
                 }
             }
@@ -322,7 +709,7 @@ bool FileClient::downloadFile(const std::string &name, const std::string &rename
                 // error：break off
                 shouldExit = true;
 
-                _callback->onWebChanged(WEB_DISCONNECTED, "net_error");
+                notifyChanged(WEB_DISCONNECTED, "net_error");
             }
             break;
             case RES_FINISH: {
@@ -330,16 +717,16 @@ bool FileClient::downloadFile(const std::string &name, const std::string &rename
                     current += size;
                     try {
                         // 写入最后一块
-                        tempFile.Write(buffer, size);
+                        writeBody(buffer, size);
                     } catch (const CppCommon::FileSystemException &ex) {
                         std::cout << "Write&Close throw FS exception: " << ex.message() << std::endl;
-                        _callback->onWebChanged(WEB_IO_ERROR, "io_error");
+                        notifyChanged(WEB_IO_ERROR, "io_error");
                     }
                 }
                 // std::cout << tempFile.string() << " RES_FINISH, current=" << current << " total:" << total << std::endl;
 
                 shouldExit = true;
-                _callback->onWebChanged(WEB_FILE_END, tempFile.string(), total);
+                finished = true;
             }
             break;
 
@@ -348,39 +735,35 @@ bool FileClient::downloadFile(const std::string &name, const std::string &rename
                 break;
             }
 
-            if (shouldExit) {
-                timeout_done.store(EXIT_COUNT);
-            }
-
             return shouldExit;
         });
 
-        _httpClient->setResponseHandler(std::move(cb));
+        client->setResponseHandler(std::move(cb));
 
         std::string url = "download/";
         // base64 the file name in order to keep original name, which may include '&'
-        std::string ename = CppCommon::Encoding::Base64Encode(name);
+        std::string ename = CppCommon::Encoding::Base64Encode(task.name);
         url.append(ename);
         url.append("&token=").append(_token);
         url.append("&offset=").append(std::to_string(offset));
+        if (task.stripe) {
+            uint64_t end = task.offset + task.length - 1;
+            url.append("&range=").append(std::to_string(task.offset)).append("-").append(std::to_string(end));
+        }
+        if (task.compress) {
+            url.append("&compress=").append(COMPRESS_ENCODING);
+        }
 
-        _httpClient->SendGetRequest(url).get(); // use get to sync download one by one
+        client->SendGetRequest(url).get(); // use get to sync download one by one
 
-        // Wait for download finish or no data arrived more than many times
-        while (!_stop.load()) {
-            auto count = timeout_done.load();
-            if (count >= EXIT_COUNT) {
-                break;
-            }
-            timeout_done.fetch_add(1);
-            CppCommon::Thread::Yield();
-            CppCommon::Thread::Sleep(1);
-        }
+        // Wait for download finish or no data arrived in time
+        client->waitFinished(_stop, DOWNLOAD_IDLE_TIMEOUT);
 
         // make sure the file has been closed
         if (tempFile.IsFileWriteOpened()) {
             try {
-                // tempFile.Flush();
+                if (finished)
+                    commitPending();
                 tempFile.Close();
                 tempFile.Clear();
             } catch (const CppCommon::FileSystemException &ex) {
@@ -388,13 +771,447 @@ bool FileClient::downloadFile(const std::string &name, const std::string &rename
             }
         }
 
-        _httpClient->setResponseHandler(nullptr);
+        if (inflating)
+            inflateEnd(&stream);
+
+        // the last closed stripe, all data has been flushed into the file.
+        if (finished && (!task.stripe || task.stripe->remaining.fetch_sub(1) == 1)) {
+            // keep the remote modified time, the next incremental sync compares it.
+            if (task.mtime > 0) {
+                try {
+                    CppCommon::Path::SetModified(task.savepath, CppCommon::UtcTimestamp(CppCommon::Timestamp(task.mtime)));
+                } catch (const CppCommon::FileSystemException &ex) {
+                    std::cout << "SetModified throw FS exception: " << ex.message() << std::endl;
+                }
+            }
+            _journal.finish(task.savepath);
+            notifyChanged(WEB_FILE_END, task.savepath, total);
+            result = true;
+        } else {
+            result = finished;
+        }
+
+        client->setResponseHandler(nullptr);
     }
     // std::cout << "$$$ file end: " << name << std::endl;
 
     return result;
 }
 
+// download the small files in one request, unpack them while the records are arriving
+// [POST]pack/&token  body: base64 names, one per line
+bool FileClient::downloadPack(HTTPFileClient *client, const DownloadTask &task)
+{
+    std::unordered_map<std::string, const PackItem *> items;
+    std::unordered_set<std::string> received;
+    std::string body;
+    for (const auto &item : task.packs) {
+        items[item.name] = &item;
+        body.append(CppCommon::Encoding::Base64Encode(item.name)).append("\n");
+    }
+
+    // the unpacking state of current record
+    std::string head; // the record header and name
+    PackHeader header;
+    uint64_t remain = 0;
+    bool inData = false;
+    // the whole body arrived, not closed in the middle
+    bool complete = false;
+    CppCommon::File current;
+
+    auto finishCurrent = [&]() {
+        if (!current.IsFileWriteOpened())
+            return;
+        try {
+            current.Close();
+            CppCommon::Path::SetPermissions(current, CppCommon::Flags<CppCommon::FilePermissions>(header.mode));
+            CppCommon::Path::SetModified(current, CppCommon::UtcTimestamp(CppCommon::Timestamp(header.mtime)));
+        } catch (const CppCommon::FileSystemException &ex) {
+            std::cout << "Close throw FS exception: " << ex.message() << std::endl;
+        }
+        _journal.finish(current.string());
+        notifyChanged(WEB_FILE_END, current.string(), header.size);
+    };
+
+    // return true if should exit
+    auto unpack = [&](const char *buffer, size_t size) -> bool {
+        while (size > 0) {
+            if (!inData) {
+                // the header, then its name
+                size_t need = PACK_HEADER_SIZE + (head.size() >= PACK_HEADER_SIZE ? header.name_len : 0) - head.size();
+                size_t num = std::min(need, size);
+                head.append(buffer, num);
+                buffer += num;
+                size -= num;
+                if (head.size() == PACK_HEADER_SIZE) {
+                    header.decode(head.data());
+                }
+                if (head.size() < PACK_HEADER_SIZE || head.size() < PACK_HEADER_SIZE + header.name_len)
+                    continue;
+
+                std::string name = head.substr(PACK_HEADER_SIZE);
+                head.clear();
+                inData = true;
+                remain = header.size;
+
+                auto it = items.find(name);
+                if (it != items.end()) {
+                    received.insert(name);
+                    try {
+                        current = CppCommon::File(it->second->savepath);
+                        current.OpenOrCreate(false, true, true);
+                    } catch (const CppCommon::FileSystemException &ex) {
+                        std::cout << "Pack create throw FS exception: " << ex.message() << std::endl;
+                        notifyChanged(WEB_IO_ERROR, "io_error");
+                        return true;
+                    }
+                    CppCommon::Path file_path = current.absolute().RemoveExtension();
+                    notifyChanged(WEB_FILE_BEGIN, file_path.string(), header.size);
+                } else {
+                    std::cout << "Unknown packed file: " << name << std::endl;
+                }
+            } else {
+                size_t num = static_cast<size_t>(std::min<uint64_t>(remain, size));
+                if (current.IsFileWriteOpened()) {
+                    try {
+                        current.Write(buffer, num);
+                    } catch (const CppCommon::FileSystemException &ex) {
+                        std::cout << "Write throw FS exception: " << ex.message() << std::endl;
+                        notifyChanged(WEB_IO_ERROR, "io_error");
+                        return true;
+                    }
+                }
+                buffer += num;
+                size -= num;
+                remain -= num;
+                if (notifyProgress(num))
+                    return true;
+            }
+
+            if (inData && remain == 0) {
+                finishCurrent();
+                inData = false;
+            }
+        }
+        return false;
+    };
+
+    ResponseHandler cb([&](int status, const char *buffer, size_t size) -> bool {
+        if (_stop.load()) {
+            std::cout << "has been canceled from outside!" << std::endl;
+            return true;
+        }
+
+        bool shouldExit = false;
+        switch (status) {
+        case RES_NOTFOUND: {
+            std::cout << "Pack not Found!" << std::endl;
+            shouldExit = true;
+            notifyChanged(WEB_NOT_FOUND, "not_found");
+        }
+        break;
+        case RES_OKHEADER:
+            break;
+        case RES_BODY: {
+            if (buffer && size > 0)
+                shouldExit = unpack(buffer, size);
+        }
+        break;
+        case RES_ERROR: {
+            shouldExit = true;
+            notifyChanged(WEB_DISCONNECTED, "net_error");
+        }
+        break;
+        case RES_FINISH: {
+            if (buffer && size > 0)
+                unpack(buffer, size);
+            complete = true;
+            shouldExit = true;
+        }
+        break;
+        default:
+            std::cout << "error, unkonw status=" << status << std::endl;
+            break;
+        }
+
+        return shouldExit;
+    });
+
+    client->setResponseHandler(std::move(cb));
+
+    std::string url = "pack/";
+    url.append("&token=").append(_token);
+    client->SendPostRequest(url, body).get();
+
+    // Wait for download finish or no data arrived in time
+    bool result = client->waitFinished(_stop, DOWNLOAD_IDLE_TIMEOUT);
+
+    // make sure the file has been closed
+    if (current.IsFileWriteOpened()) {
+        try {
+            current.Close();
+        } catch (const CppCommon::FileSystemException &ex) {
+            std::cout << "Close throw FS exception: " << ex.message() << std::endl;
+        }
+    }
+
+    client->setResponseHandler(nullptr);
+    if (!result || !complete || inData)
+        return false;
+
+    // the server skips the files which are gone or grown too big to pack, get them by themselves
+    for (const auto &item : task.packs) {
+        if (_stop.load())
+            return false;
+        if (received.count(item.name) > 0)
+            continue;
+
+        DownloadTask single;
+        single.name = item.name;
+        single.savepath = item.savepath;
+        single.size = item.size;
+        if (!downloadFile(client, single))
+            return false;
+    }
+    return true;
+}
+
+// download the compressible file or its stripe by windows, the server compresses the window if it is worth.
+bool FileClient::downloadWindows(HTTPFileClient *client, const DownloadTask &task)
+{
+    uint64_t begin = task.stripe ? task.offset : 0;
+    uint64_t length = task.stripe ? task.length : static_cast<uint64_t>(task.size);
+    uint64_t count = (length + COMPRESS_WINDOW_SIZE - 1) / COMPRESS_WINDOW_SIZE;
+
+    // every window is one stripe of the file
+    auto stripe = task.stripe;
+    if (stripe) {
+        stripe->remaining.fetch_add(static_cast<int>(count) - 1);
+    } else {
+        stripe = std::make_shared<StripeState>();
+        stripe->remaining.store(static_cast<int>(count));
+    }
+
+    for (uint64_t i = 0; i < count; ++i) {
+        if (_stop.load())
+            return false;
+
+        DownloadTask window = task;
+        window.compress = true;
+        window.stripe = stripe;
+        window.offset = begin + i * COMPRESS_WINDOW_SIZE;
+        window.length = std::min<uint64_t>(COMPRESS_WINDOW_SIZE, length - i * COMPRESS_WINDOW_SIZE);
+        if (!downloadFile(client, window))
+            return false;
+    }
+    return true;
+}
+
+// continue the broken file: verify the committed ranges in journal, download the rest in parallel
+bool FileClient::downloadResume(HTTPFileClient *client, const DownloadTask &task)
+{
+    DownloadTask whole = task;
+    whole.resume = false;
+
+    auto parts = _journal.parts(task.savepath);
+
+    std::vector<std::pair<uint64_t, uint64_t>> verified; // the intact [offset, offset + length)
+    try {
+        CppCommon::File local(task.savepath);
+        local.Open(true, true, false, CppCommon::File::DEFAULT_ATTRIBUTES, CppCommon::File::DEFAULT_PERMISSIONS, 0);
+        local.Resize(task.size);
+
+        std::vector<char> buffer(STREAM_BLOCK_SIZE);
+        for (const auto &part : parts) {
+            if (_stop.load())
+                return false;
+            if (part.offset + part.length > static_cast<uint64_t>(task.size))
+                continue;
+
+            local.Seek(part.offset);
+            BlockHash::Hasher hasher;
+            uint64_t remain = part.length;
+            while (remain > 0) {
+                size_t read_sz = local.Read(buffer.data(), static_cast<size_t>(std::min<uint64_t>(remain, buffer.size())));
+                if (read_sz == 0)
+                    break;
+                hasher.update(buffer.data(), read_sz);
+                remain -= read_sz;
+            }
+            if (remain == 0 && hasher.digest() == part.hash)
+                verified.emplace_back(part.offset, part.length);
+        }
+        local.Close();
+    } catch (const CppCommon::FileSystemException &ex) {
+        std::cout << "Verify journal throw FS exception: " << ex.message() << std::endl;
+        verified.clear();
+    }
+
+    // the missing ranges between the verified ones
+    std::sort(verified.begin(), verified.end());
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    uint64_t cursor = 0;
+    for (const auto &range : verified) {
+        if (range.first > cursor)
+            ranges.emplace_back(cursor, range.first - cursor);
+        cursor = std::max(cursor, range.first + range.second);
+    }
+    if (cursor < static_cast<uint64_t>(task.size))
+        ranges.emplace_back(cursor, task.size - cursor);
+
+    if (ranges.empty()) {
+        // all data has been written before broken
+        notifyChanged(WEB_FILE_BEGIN, task.savepath, task.size);
+        if (task.mtime > 0) {
+            try {
+                CppCommon::Path::SetModified(task.savepath, CppCommon::UtcTimestamp(CppCommon::Timestamp(task.mtime)));
+            } catch (const CppCommon::FileSystemException &ex) {
+                std::cout << "SetModified throw FS exception: " << ex.message() << std::endl;
+            }
+        }
+        _journal.finish(task.savepath);
+        notifyChanged(WEB_FILE_END, task.savepath, task.size);
+        return true;
+    }
+
+    // split the missing ranges into pieces, download them like the stripes of file
+    uint64_t missing = 0;
+    for (const auto &range : ranges)
+        missing += range.second;
+    uint64_t piece = std::max<uint64_t>(STRIPE_MIN_SIZE, missing / _channels.size());
+
+    std::vector<DownloadTask> pieces;
+    for (const auto &range : ranges) {
+        for (uint64_t done = 0; done < range.second; done += piece) {
+            DownloadTask part = whole;
+            part.offset = range.first + done;
+            part.length = std::min<uint64_t>(piece, range.second - done);
+            pieces.push_back(std::move(part));
+        }
+    }
+
+    auto stripe = std::make_shared<StripeState>();
+    stripe->remaining.store(static_cast<int>(pieces.size()));
+    for (auto &part : pieces) {
+        part.stripe = stripe;
+        if (&part == &pieces.front())
+            continue;
+        dispatchTask(std::move(part));
+    }
+    // download the first piece in this channel
+    return downloadFile(client, pieces.front());
+}
+
+// patch the exist file: compare the block hashes, download the changed blocks only
+// [GET]blocksum/<name>&token
+bool FileClient::downloadDelta(HTTPFileClient *client, const DownloadTask &task)
+{
+    DownloadTask whole = task;
+    whole.delta = false;
+
+    std::vector<std::pair<uint64_t, uint64_t>> ranges; // the changed [offset, offset + length)
+    bool compared = false;
+    try {
+        // the sums arrive while the server hashing, wait for them by the idle timeout
+        std::string sums;
+        bool complete = false;
+        ResponseHandler cb([&](int status, const char *buffer, size_t size) -> bool {
+            switch (status) {
+            case RES_OKHEADER:
+                break;
+            case RES_BODY:
+            case RES_FINISH:
+                if (buffer && size > 0)
+                    sums.append(buffer, size);
+                complete = (status == RES_FINISH);
+                break;
+            default:
+                // the old server, or broken off
+                return true;
+            }
+            return _stop.load();
+        });
+        client->setResponseHandler(std::move(cb));
+
+        std::string url = "blocksum/";
+        url.append(CppCommon::Encoding::Base64Encode(task.name));
+        url.append("&token=").append(_token);
+        client->SendGetRequest(url);
+        client->waitFinished(_stop, DOWNLOAD_IDLE_TIMEOUT);
+        client->setResponseHandler(nullptr);
+
+        uint64_t count = (task.size + DELTA_BLOCK_SIZE - 1) / DELTA_BLOCK_SIZE;
+        if (complete && sums.size() == count * 8) {
+            CppCommon::File local(task.savepath);
+            local.Open(true, true, false, CppCommon::File::DEFAULT_ATTRIBUTES, CppCommon::File::DEFAULT_PERMISSIONS, 0);
+            local.Resize(task.size);
+
+            std::vector<char> buffer(DELTA_BLOCK_SIZE);
+            for (uint64_t i = 0; i < count && !_stop.load(); ++i) {
+                uint64_t offset = i * DELTA_BLOCK_SIZE;
+                size_t length = static_cast<size_t>(std::min<uint64_t>(DELTA_BLOCK_SIZE, task.size - offset));
+                size_t read_sz = local.Read(buffer.data(), length);
+                if (read_sz == length && BlockHash::hash(buffer.data(), length) == BlockHash::decode(sums.data() + i * 8))
+                    continue;
+
+                // merge the continuous changed blocks into one range
+                if (!ranges.empty() && ranges.back().first + ranges.back().second == offset) {
+                    ranges.back().second += length;
+                } else {
+                    ranges.emplace_back(offset, length);
+                }
+            }
+            local.Close();
+            compared = true;
+        }
+    } catch (const std::exception &ex) {
+        std::cout << "Compare blocks exception: " << ex.what() << std::endl;
+    }
+
+    if (!compared) {
+        // the old server or the file has been changed, download the whole file again
+        try {
+            CppCommon::File::WriteEmpty(task.savepath);
+        } catch (const CppCommon::FileSystemException &ex) {
+            std::cout << "Truncate throw FS exception: " << ex.message() << std::endl;
+            notifyChanged(WEB_IO_ERROR, "io_error");
+            return false;
+        }
+        return downloadFile(client, whole);
+    }
+
+    if (ranges.empty()) {
+        // only the modified time is changed
+        notifyChanged(WEB_FILE_BEGIN, task.savepath, task.size);
+        notifyChanged(WEB_FILE_END, task.savepath, task.size);
+        if (task.mtime > 0) {
+            try {
+                CppCommon::Path::SetModified(task.savepath, CppCommon::UtcTimestamp(CppCommon::Timestamp(task.mtime)));
+            } catch (const CppCommon::FileSystemException &ex) {
+                std::cout << "SetModified throw FS exception: " << ex.message() << std::endl;
+            }
+        }
+        return true;
+    }
+
+    // download the changed ranges like the stripes of file
+    auto stripe = std::make_shared<StripeState>();
+    stripe->remaining.store(static_cast<int>(ranges.size()));
+
+    bool result = true;
+    for (const auto &range : ranges) {
+        if (_stop.load())
+            return false;
+
+        DownloadTask part = whole;
+        part.offset = range.first;
+        part.length = range.second;
+        part.stripe = stripe;
+        result = downloadFile(client, part) && result;
+    }
+    return result;
+}
+
 void FileClient::downloadFolder(const std::string &foldername, const std::string &refoldername)
 {
     // create a override folder
@@ -405,7 +1222,7 @@ void FileClient::downloadFolder(const std::string &foldername, const std::string
         auto ok = createNotExistPath(absapth, false);
         if (!ok && absapth.empty()) {
             // FS exception hanppend
-            _callback->onWebChanged(WEB_IO_ERROR, "fs_exception");
+            notifyChanged(WEB_IO_ERROR, "fs_exception");
             return;
         }
     }
@@ -423,7 +1240,7 @@ void FileClient::downloadFolder(const std::string &foldername, const std::string
         int64_t size = entry.size;
         if (size > 0) {
             // replace with the new folder if need
-            downloadFile(relName, refoldername.empty() ? "" : repName);
+            scheduleFile(relName, refoldername.empty() ? "" : repName, size);
         } else if (size < 0) {
             downloadFolder(relName, refoldername.empty() ? "" : repName);
         } else {
@@ -433,16 +1250,154 @@ void FileClient::downloadFolder(const std::string &foldername, const std::string
     }
 }
 
+bool FileClient::downloadManifest(const std::string &foldername, const std::string &refoldername)
+{
+    struct ManifestState {
+        std::mutex lock;
+        std::condition_variable cond;
+        std::string partial; // the incomplete line
+        std::deque<std::string> lines;
+        bool accepted { false };
+        bool done { false };
+        // the last chunk has arrived, the whole tree is listed
+        bool complete { false };
+    };
+    auto state = std::make_shared<ManifestState>();
+
+    ResponseHandler cb([this, state](int status, const char *buffer, size_t size) -> bool {
+        std::lock_guard<std::mutex> locker(state->lock);
+        switch (status) {
+        case RES_OKHEADER:
+            state->accepted = true;
+            break;
+        case RES_BODY:
+        case RES_FINISH: {
+            if (buffer && size > 0)
+                state->partial.append(buffer, size);
+
+            size_t start = 0, end = 0;
+            while ((end = state->partial.find('\n', start)) != std::string::npos) {
+                state->lines.push_back(state->partial.substr(start, end - start));
+                start = end + 1;
+            }
+            state->partial.erase(0, start);
+            state->done = (status == RES_FINISH);
+            state->complete = (status == RES_FINISH);
+        }
+        break;
+        default:
+            // not found, unsupported or broken off
+            state->done = true;
+            break;
+        }
+        state->cond.notify_one();
+        return _stop.load();
+    });
+    _httpClient->setResponseHandler(std::move(cb));
+
+    // [GET]manifest/<name>&token
+    std::string url = "manifest/";
+    url.append(CppCommon::Encoding::Base64Encode(foldername));
+    url.append("&token=").append(_token);
+    _httpClient->SendGetRequest(url);
+
+    // dispatch the arrived entries while the rest is arriving
+    bool accepted = false;
+    bool complete = false;
+    while (!_stop.load()) {
+        std::deque<std::string> lines;
+        bool done = false;
+        {
+            std::unique_lock<std::mutex> locker(state->lock);
+            bool arrived = state->cond.wait_for(locker, std::chrono::milliseconds(DOWNLOAD_IDLE_TIMEOUT), [&state]() {
+                return state->done || !state->lines.empty();
+            });
+            accepted = state->accepted;
+            if (!arrived) {
+                std::cout << "manifest timeout: " << foldername << std::endl;
+                break;
+            }
+            lines.swap(state->lines);
+            done = state->done;
+            complete = state->complete;
+        }
+
+        for (const auto &line : lines) {
+            picojson::value v;
+            std::string err = picojson::parse(v, line);
+            if (!err.empty()) {
+                std::cout << "Failed to parse manifest line: " << err << std::endl;
+                continue;
+            }
+            ManifestEntry entry;
+            entry.from_json(v);
+            handleManifestEntry(entry, foldername, refoldername);
+        }
+
+        if (done)
+            break;
+    }
+
+    _httpClient->setResponseHandler(nullptr);
+    if (!complete) {
+        // the rest of the abandoned response may still arrive, do not reuse the connection
+        _httpClient->Disconnect();
+    }
+
+    // dispatch the rest small files
+    flushPack();
+
+    if (accepted && !complete && !_stop.load()) {
+        // some entries are missing, the tree can not be listed again without duplicates
+        std::cout << "manifest broken off: " << foldername << std::endl;
+        notifyChanged(WEB_DISCONNECTED, "net_error");
+    }
+    return accepted;
+}
+
+void FileClient::handleManifestEntry(const ManifestEntry &entry, const std::string &foldername, const std::string &refoldername)
+{
+    std::string relName = foldername + "/" + entry.name;
+    std::string repName = refoldername + "/" + entry.name;
+    const std::string &saveName = refoldername.empty() ? relName : repName;
+
+    if (entry.size > 0 && entry.size < PACK_FILE_MAX) {
+        // the small file, download it with others together
+        schedulePack(relName, refoldername.empty() ? "" : repName, entry.size, entry.mtime);
+    } else if (entry.size > 0) {
+        // replace with the new folder if need
+        scheduleFile(relName, refoldername.empty() ? "" : repName, entry.size, entry.mtime);
+    } else if (entry.size < 0) {
+        // the parent always comes before its entries
+        CppCommon::Path path = CppCommon::Path(_savedir) / saveName;
+        auto abspath = path.canonical().string();
+        auto ok = createNotExistPath(abspath, false);
+        if (!ok && abspath.empty()) {
+            // FS exception hanppend
+            notifyChanged(WEB_IO_ERROR, "fs_exception");
+        }
+    } else {
+        // 链接文件或大小为0的空文件, keep the exist one empty if sync into it
+        DownloadTask task;
+        task.mtime = entry.mtime;
+        reserveFile(saveName, task);
+    }
+}
+
 void FileClient::walkDownload(const std::vector<std::string> &webnames)
 {
+    // the incremental sync compares the exist files instead
+    if (!_incremental)
+        _journal.open(_savedir);
+
     sendInfobyHeader(INFO_WEB_START);
-    _callback->onWebChanged(WEB_TRANS_START);
+    notifyChanged(WEB_TRANS_START);
 
     for (const auto& name : webnames) {
         //std::cout << "start download web: " << name << std::endl;
 
         sendInfobyHeader(INFO_WEB_INDEX, name);
-        _callback->onWebChanged(WEB_INDEX_BEGIN, name);
+        notifyChanged(WEB_INDEX_BEGIN, name);
 
         // do not sure the file type: floder or file
         auto info = requestInfo(name);
@@ -453,10 +1408,24 @@ void FileClient::walkDownload(const std::vector<std::string> &webnames)
 
         // file: size > 0; dir: size < 0; default size = 0
         if (info.size > 0) {
-            downloadFile(name);
+            scheduleFile(name, "", info.size);
         } else {
             // check and create the first index dir, ex. a -> /xx/download/a(1)
-            std::string replacePath = createNextAvailableName(name, false);
+            std::string replacePath;
+            if (_incremental) {
+                // sync into the exist one
+                replacePath = savePathOf(name, false).string();
+                if (!CppCommon::Path(replacePath).IsDirectory() && !createNotExistPath(replacePath, false))
+                    replacePath = createNextAvailableName(name, false);
+            } else {
+                // continue the broken download in its folder
+                replacePath = _journal.findFolder(name);
+                if (replacePath.empty() || !CppCommon::Path(replacePath).IsDirectory()) {
+                    replacePath = createNextAvailableName(name, false);
+                    if (!replacePath.empty())
+                        _journal.addFolder(name, replacePath);
+                }
+            }
             if (replacePath.empty()) {
                 // can not get a replace folder, skip.
                 std::cout << name << "can not get a replace folder, skip!" << std::endl;
@@ -465,21 +1434,173 @@ void FileClient::walkDownload(const std::vector<std::string> &webnames)
             std::string avainame = CppCommon::Path(replacePath).filename().string();
             std::string rename = (name == avainame) ? "" : avainame;
             // if need, change all sub files storage dir, e.x <save>/a : <save>/a(1)
-            downloadFolder(name, rename);
+            if (!downloadManifest(name, rename)) {
+                // the old server: request info for every sub dir
+                downloadFolder(name, rename);
+            }
         }
 
         if (_stop.load()) {
             std::cout << "User stop to download!" << std::endl;
+            _journal.close();
             return;
         }
     }
+
+    // all files have been dispatched, wait for them done.
+    flushPack();
+    waitChannelsIdle();
+    if (_stop.load()) {
+        std::cout << "User stop to download!" << std::endl;
+        _journal.close();
+        return;
+    }
     std::cout << "whole download finished!" << std::endl;
+    _journal.clear();
 
     sendInfobyHeader(INFO_WEB_FINISH);
-    _callback->onWebChanged(WEB_TRANS_FINISH);
+    notifyChanged(WEB_TRANS_FINISH);
     std::cout << "whole download finished end thread!" << std::endl;
 }
 
+void FileClient::scheduleFile(const std::string &name, const std::string &rename, int64_t size, int64_t mtime)
+{
+    DownloadTask task;
+    task.name = name;
+    task.size = size;
+    task.mtime = mtime;
+    task.length = size;
+
+    // reserve the save path here, keep the names in order.
+    if (!reserveFile(rename.empty() ? name : rename, task))
+        return;
+
+    if (_channels.empty())
+        return;
+
+    if (!task.delta && !task.resume && scheduleStripes(task))
+        return;
+
+    dispatchTask(std::move(task));
+}
+
+void FileClient::schedulePack(const std::string &name, const std::string &rename, int64_t size, int64_t mtime)
+{
+    DownloadTask task;
+    task.size = size;
+    task.mtime = mtime;
+
+    // reserve the save path here, keep the names in order.
+    if (!reserveFile(rename.empty() ? name : rename, task))
+        return;
+
+    PackItem item;
+    item.name = name;
+    item.savepath = task.savepath;
+    item.size = size;
+    _pack_task.packs.push_back(std::move(item));
+    _pack_task.length += size;
+
+    if (_pack_task.length >= PACK_BATCH_SIZE || _pack_task.packs.size() >= PACK_BATCH_COUNT)
+        flushPack();
+}
+
+void FileClient::flushPack()
+{
+    if (_pack_task.packs.empty())
+        return;
+
+    DownloadTask task;
+    std::swap(task, _pack_task);
+    if (_channels.empty())
+        return;
+
+    dispatchTask(std::move(task));
+}
+
+void FileClient::dispatchTask(DownloadTask task)
+{
+    // the least pending bytes one
+    auto target = _channels.front();
+    uint64_t least = target->pendingBytes();
+    for (const auto &channel : _channels) {
+        uint64_t pending = channel->pendingBytes();
+        if (pending < least) {
+            least = pending;
+            target = channel;
+        }
+    }
+    target->push(std::move(task));
+}
+
+bool FileClient::scheduleStripes(const DownloadTask &whole)
+{
+    const std::string &savepath = whole.savepath;
+    int64_t size = whole.size;
+    uint64_t count = std::min<uint64_t>(_channels.size(), size / STRIPE_MIN_SIZE);
+    if (count < 2)
+        return false;
+
+    try {
+        // preallocate the whole file, every stripe writes into its own range.
+        CppCommon::File file(savepath);
+        file.OpenOrCreate(false, true, true);
+        file.Resize(size);
+        file.Close();
+    } catch (const CppCommon::FileSystemException &ex) {
+        std::cout << "Preallocate throw FS exception: " << ex.message() << std::endl;
+        notifyChanged(WEB_IO_ERROR, "io_error");
+        return true;
+    }
+
+    auto stripe = std::make_shared<StripeState>();
+    stripe->remaining.store(static_cast<int>(count));
+
+    uint64_t length = (size + count - 1) / count;
+    for (uint64_t i = 0; i < count; ++i) {
+        DownloadTask task = whole;
+        task.offset = i * length;
+        task.length = std::min<uint64_t>(length, size - task.offset);
+        task.stripe = stripe;
+        _channels[i]->push(std::move(task));
+    }
+
+    return true;
+}
+
+void FileClient::createChannels()
+{
+    if (static_cast<int>(_channels.size()) == _connections)
+        return;
+
+    _channels.clear();
+    for (int i = 0; i < _connections; ++i) {
+        auto client = std::make_shared<HTTPFileClient>(_service, _context, _address, _port);
+        client->SetupNoDelay(true);
+        _channels.push_back(std::make_shared<DownloadChannel>(this, client));
+    }
+}
+
+void FileClient::waitChannelsIdle()
+{
+    std::unique_lock<std::mutex> locker(_idle_lock);
+    _idle_cond.wait(locker, [this]() {
+        if (_stop.load())
+            return true;
+        for (const auto &channel : _channels) {
+            if (!channel->idle())
+                return false;
+        }
+        return true;
+    });
+}
+
+void FileClient::notifyChannelIdle()
+{
+    std::lock_guard<std::mutex> locker(_idle_lock);
+    _idle_cond.notify_all();
+}
+
 bool FileClient::createNotExistPath(std::string &abspath, bool isfile)
 {
     CppCommon::Path path(abspath);
@@ -536,23 +1657,7 @@ bool FileClient::createNotExistPath(std::string &abspath, bool isfile)
 
 std::string FileClient::createNextAvailableName(const std::string &name, bool isfile)
 {
-    CppCommon::Path path = CppCommon::Path(_savedir) / name;
-    path = path.canonical(); // remove all '.' and '..' properly
-
-    // save file security check
-    if (isfile) {
-        try {
-            // Redirect to Download folder if save into Home
-            if (path.parent().IsEquivalent(path.home())) {
-                std::cout << "Save dir is user Home, forbid! " << path.string() << std::endl;
-                path = path.parent() / "Download" / path.filename();
-            }
-        } catch (const CppCommon::FileSystemException &ex) {
-            // 捕获并处理异常
-            // std::cout << "IsEquivalent throw FS exception: " << ex.message()<< std::endl;
-        }
-    }
-
+    CppCommon::Path path = savePathOf(name, isfile);
     auto abspath = path.string();
     if (createNotExistPath(abspath, isfile)) {
         return abspath;
@@ -578,3 +1683,94 @@ std::string FileClient::createNextAvailableName(const std::string &name, bool is
         i++;
     }
 }
+
+CppCommon::Path FileClient::savePathOf(const std::string &name, bool isfile)
+{
+    CppCommon::Path path = CppCommon::Path(_savedir) / name;
+    path = path.canonical(); // remove all '.' and '..' properly
+
+    // save file security check
+    if (isfile) {
+        try {
+            // Redirect to Download folder if save into Home
+            if (path.parent().IsEquivalent(path.home())) {
+                std::cout << "Save dir is user Home, forbid! " << path.string() << std::endl;
+                path = path.parent() / "Download" / path.filename();
+            }
+        } catch (const CppCommon::FileSystemException &ex) {
+            // 捕获并处理异常
+            // std::cout << "IsEquivalent throw FS exception: " << ex.message()<< std::endl;
+        }
+    }
+
+    return path;
+}
+
+bool FileClient::reserveFile(const std::string &savename, DownloadTask &task)
+{
+    std::string &savepath = task.savepath;
+    int64_t size = task.size;
+    int64_t mtime = task.mtime;
+    task.delta = false;
+    task.resume = false;
+
+    JournalFile record;
+    if (_journal.findFile(savename, size, mtime, record)) {
+        // the broken download before, continue it in the same file
+        try {
+            if (CppCommon::Path(record.path).IsRegularFile()) {
+                savepath = record.path;
+                if (record.done && static_cast<int64_t>(CppCommon::File(savepath).size()) == size) {
+                    notifyChanged(WEB_FILE_BEGIN, savepath, size);
+                    notifyChanged(WEB_FILE_END, savepath, size);
+                    return false;
+                }
+                if (size >= CHECKPOINT_SIZE) {
+                    task.resume = true;
+                    return true;
+                }
+                CppCommon::File::WriteEmpty(savepath);
+                return true;
+            }
+        } catch (const CppCommon::FileSystemException &ex) {
+            std::cout << "Reuse journal file throw FS exception: " << ex.message() << std::endl;
+        }
+    }
+
+    if (_incremental) {
+        CppCommon::Path path = savePathOf(savename, true);
+        try {
+            if (path.IsRegularFile()) {
+                savepath = path.string();
+                int64_t localsize = static_cast<int64_t>(CppCommon::File(path).size());
+                // compare the modified time in seconds, the file systems keep different precisions.
+                int64_t localtime = static_cast<int64_t>(path.modified().seconds());
+                if (mtime > 0 && localsize == size && localtime == mtime / 1000000000) {
+                    // the same one, skip it
+                    notifyChanged(WEB_FILE_BEGIN, savepath, size);
+                    notifyChanged(WEB_FILE_END, savepath, size);
+                    return false;
+                }
+                if (size >= DELTA_MIN_SIZE && localsize > 0) {
+                    task.delta = true;
+                    return true;
+                }
+                // download it again
+                CppCommon::File::WriteEmpty(path);
+                return true;
+            }
+        } catch (const CppCommon::FileSystemException &ex) {
+            std::cout << "Reuse exist file throw FS exception: " << ex.message() << std::endl;
+        }
+    }
+
+    savepath = createNextAvailableName(savename, true);
+    if (savepath.empty()) {
+        //FS exception now
+        std::cout << "createNextAvailableName exception now! " << savename << std::endl;
+        notifyChanged(WEB_IO_ERROR, "fs_exception");
+        return false;
+    }
+    _journal.addFile(savename, savepath, size, mtime);
+    return true;
+}
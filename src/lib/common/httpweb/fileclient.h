@@ -6,14 +6,49 @@
 #define FILECLIENT_H
 
 #include "server/asio/ssl_context.h"
+#include "filesystem/path.h"
 #include "syncstatus.h"
+#include "transferjournal.h"
 
 #include "webproto.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+
+// the state shared by all stripes of one big file
+struct StripeState {
+    std::atomic<int> remaining {0};
+    std::atomic<bool> started {false};
+};
+
+// the small file which is packed with others
+struct PackItem {
+    std::string name; // the web name
+    std::string savepath; // the available local path
+    int64_t size {0};
+};
+
+struct DownloadTask {
+    std::string name; // the web name
+    std::string savepath; // the available local path
+    int64_t size {0}; // the whole file size
+    int64_t mtime {0}; // keep the remote modified time if known (ns)
+    uint64_t offset {0}; // the downloading range: [offset, offset + length)
+    uint64_t length {0};
+    std::shared_ptr<StripeState> stripe { nullptr }; // null if download whole file
+    std::vector<PackItem> packs; // the small files downloaded in one request
+    bool delta { false }; // patch the exist file with the changed blocks
+    bool compress { false }; // accept the compressed window
+    bool resume { false }; // continue the broken file by the journal
+};
+
 class HTTPFileClient;
+class DownloadChannel;
 class FileClient : public WebInterface
 {
     friend class HTTPFileClient;
+    friend class DownloadChannel;
 public:
     FileClient(const std::shared_ptr<CppServer::Asio::Service> &service, const std::shared_ptr<CppServer::Asio::SSLContext>& context, const std::string &address, int port);
     ~FileClient();
@@ -21,6 +56,10 @@ public:
     std::vector<std::string> parseWeb(const std::string &token);
 
     void setConfig(const std::string &token, const std::string &savedir);
+    // set the count of parallel download connections, must be set before download.
+    void setConnections(int count);
+    // incremental sync: reuse the exist files, skip the same ones and patch the changed ones.
+    void setIncremental(bool incremental);
     void stop();
 
     // start download in new thread
@@ -30,18 +69,54 @@ private:
     void sendInfobyHeader(uint8_t mask, const std::string &name = "");
     InfoEntry requestInfo(const std::string &name);
     std::string getHeadKey(const std::string &headstrs, const std::string &keyfind);
-    bool downloadFile(const std::string &name, const std::string &rename = "");
+    bool downloadFile(HTTPFileClient *client, const DownloadTask &task);
+    bool downloadPack(HTTPFileClient *client, const DownloadTask &task);
+    bool downloadDelta(HTTPFileClient *client, const DownloadTask &task);
+    bool downloadWindows(HTTPFileClient *client, const DownloadTask &task);
+    bool downloadResume(HTTPFileClient *client, const DownloadTask &task);
     void downloadFolder(const std::string &foldername, const std::string &refoldername = "");
+    // request the whole tree in one manifest, return false if the server does not support it.
+    // A manifest broken off before its end is reported as a disconnection.
+    bool downloadManifest(const std::string &foldername, const std::string &refoldername = "");
+    void handleManifestEntry(const ManifestEntry &entry, const std::string &foldername, const std::string &refoldername);
     void walkDownload(const std::vector<std::string> &webnames);
     bool createNotExistPath(std::string &abspath, bool isfile);
     std::string createNextAvailableName(const std::string &name, bool isfile);
+    CppCommon::Path savePathOf(const std::string &name, bool isfile);
+    // reserve the save path of the task file, return false if it does not need to download.
+    bool reserveFile(const std::string &savename, DownloadTask &task);
 
+    // dispatch the file into the least loaded download channel, or split big file into stripes
+    void scheduleFile(const std::string &name, const std::string &rename, int64_t size, int64_t mtime = 0);
+    bool scheduleStripes(const DownloadTask &whole);
+    // collect the small file into pack, which is dispatched while it is full.
+    void schedulePack(const std::string &name, const std::string &rename, int64_t size, int64_t mtime = 0);
+    void flushPack();
+    void dispatchTask(DownloadTask task);
+    void createChannels();
+    void waitChannelsIdle();
+    void notifyChannelIdle();
 
+    std::shared_ptr<CppServer::Asio::Service> _service { nullptr };
+    std::shared_ptr<CppServer::Asio::SSLContext> _context { nullptr };
+    std::string _address;
+    int _port { 0 };
+
+    // the control connection: info and header request
     std::shared_ptr<HTTPFileClient> _httpClient { nullptr };
     std::thread _download_thread;
 
+    // the data connections: download files in parallel
+    int _connections { DOWNLOAD_CONNECTIONS };
+    std::vector<std::shared_ptr<DownloadChannel>> _channels;
+    DownloadTask _pack_task;
+    std::mutex _idle_lock;
+    std::condition_variable _idle_cond;
+
     std::string _token;
     std::string _savedir;
+    bool _incremental { false };
+    TransferJournal _journal;
     std::atomic<bool> _stop { false };
 };
 
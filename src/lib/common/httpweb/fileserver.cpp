@@ -10,6 +10,12 @@
 #include "server/http/http_response.h"
 
 #include "webproto.h"
+#include "blockhash.h"
+#include "webcompress.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 
 class HTTPFileSession : public CppServer::HTTP::HTTPSSession
 {
@@ -21,7 +27,28 @@ public:
         _handler = std::move(cb);
     }
 
+    void setBinder(std::shared_ptr<WebBinder> binder)
+    {
+        _binder = std::move(binder);
+    }
+
 protected:
+    // the session is bound to the token it authenticated with, the later requests with the same
+    // token skip the verification until the token expires.
+    bool authorized(const std::string &token)
+    {
+        if (!_token.empty() && token == _token && std::chrono::system_clock::now() < _token_expires)
+            return true;
+
+        std::chrono::system_clock::time_point expires;
+        if (!TokenCache::GetInstance().verifyToken(token, &expires))
+            return false;
+
+        _token = token;
+        _token_expires = expires;
+        return true;
+    }
+
     InfoEntry putFileInfo(const CppCommon::Path &entry)
     {
         InfoEntry info;
@@ -63,48 +90,421 @@ protected:
         }
     }
 
-    void serveContent(const CppCommon::Path &path, size_t offset)
+    // send the manifest lines in chunks, the walk may be long so do not hold them too long.
+    void flushManifest(std::string &lines, bool force)
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (lines.empty() || (!force && lines.size() < STREAM_BLOCK_SIZE && now - _manifest_flushed < std::chrono::milliseconds(STREAM_FLUSH_MS)))
+            return;
+
+        char size[32];
+        int num = snprintf(size, sizeof(size), "%zx\r\n", lines.size());
+        std::string chunk(size, static_cast<size_t>(num));
+        chunk.append(lines).append("\r\n");
+        SendResponseBody(chunk.data(), chunk.size());
+        lines.clear();
+        _manifest_flushed = now;
+    }
+
+    // walk the dir recursively, write every entry as one json line. The real paths of the dirs
+    // on the way are visited, a link to any of them is listed but not walked again.
+    void walkManifest(const CppCommon::Path &dir, const std::string &prefix, std::vector<std::string> &visited, std::string &lines)
+    {
+        try {
+            for (const auto &item : CppCommon::Directory(dir)) {
+                // the client has gone, stop walking
+                if (!IsConnected())
+                    return;
+
+                const CppCommon::Path entry = item.IsSymlink() ? CppCommon::Symlink(item).target() : item;
+
+                // keep the link name, the client requests by this path
+                ManifestEntry manifest;
+                manifest.name = prefix + item.filename().string();
+                manifest.size = putFileInfo(entry).size;
+                if (manifest.size >= 0 && entry.IsRegularFile()) {
+                    // compare it with the exist one in incremental sync
+                    manifest.mtime = static_cast<int64_t>(entry.modified().total());
+                }
+
+                lines.append(manifest.as_json().serialize()).append("\n");
+                flushManifest(lines, false);
+
+                if (manifest.size < 0) {
+                    std::string real = item.canonical().string();
+                    if (std::find(visited.begin(), visited.end(), real) != visited.end()) {
+                        std::cout << "Manifest skip the link loop: " << item.string() << std::endl;
+                        continue;
+                    }
+                    visited.push_back(real);
+                    walkManifest(item, manifest.name + "/", visited, lines);
+                    visited.pop_back();
+                }
+            }
+        } catch (const CppCommon::FileSystemException &ex) {
+            std::cout << "Manifest walk throw FS exception: " << ex.message() << std::endl;
+        }
+    }
+
+    // serve the whole tree in one response, the entries are sent while walking. The length is
+    // unknown before the walk ends, so the body is chunked, the last chunk tells the client that
+    // the walk is complete.
+    void serveManifest(const CppCommon::Path &path)
+    {
+        CppCommon::File info(path);
+        if (!info.IsExists()) {
+            SendResponseAsync(response().MakeErrorResponse(404, "Not found."));
+            return;
+        }
+
+        response().Clear();
+        response().SetBegin(200);
+        response().SetHeader("Content-Type", "application/x-ndjson; charset=UTF-8");
+        response().SetHeader("Transfer-Encoding", "chunked");
+
+        // the response ends its header only by a length, end it with the empty line here
+        std::string header(response().cache());
+        header.append("\r\n");
+        SendResponseBody(header.data(), header.size());
+
+        // the client dispatches the arrived entries while the rest is walking.
+        std::string lines;
+        _manifest_flushed = std::chrono::steady_clock::now();
+        if (info.IsDirectory()) {
+            std::vector<std::string> visited;
+            try {
+                visited.push_back(path.canonical().string());
+            } catch (const CppCommon::FileSystemException &ex) {
+                std::cout << "Manifest root throw FS exception: " << ex.message() << std::endl;
+            }
+            walkManifest(path, "", visited, lines);
+        }
+        flushManifest(lines, true);
+
+        // the last chunk
+        SendResponseBody("0\r\n\r\n", 5);
+    }
+
+    // serve the hash of every DELTA_BLOCK_SIZE block, the client fetches the changed blocks only.
+    // The sums are sent while hashing, a big file takes long to hash.
+    void serveBlockSum(const CppCommon::Path &path)
+    {
+        CppCommon::File info(path);
+        if (!info.IsExists() || !info.IsRegularFile()) {
+            SendResponseAsync(response().MakeErrorResponse(404, "Not found."));
+            return;
+        }
+
+        uint64_t count = 0;
+        try {
+            count = (info.size() + DELTA_BLOCK_SIZE - 1) / DELTA_BLOCK_SIZE;
+            info.Open(true, false, false, CppCommon::File::DEFAULT_ATTRIBUTES, CppCommon::File::DEFAULT_PERMISSIONS, 0);
+        } catch (const CppCommon::FileSystemException &ex) {
+            std::cout << "Block sum throw FS exception: " << ex.message() << std::endl;
+            SendResponseAsync(response().MakeErrorResponse(404, "Not found."));
+            return;
+        }
+
+        response().Clear();
+        response().SetBegin(200);
+        response().SetHeader("Content-Type", "application/octet-stream");
+        response().SetBodyLength(count * 8);
+
+        // send headers first
+        SendResponse(response());
+
+        std::string sums;
+        auto flushed = std::chrono::steady_clock::now();
+        try {
+            for (uint64_t i = 0; i < count; ++i) {
+                size_t read_sz = readWindow(info, DELTA_BLOCK_SIZE);
+                char sum[8];
+                BlockHash::encode(BlockHash::hash(_stream_buffer.data(), read_sz), sum);
+                sums.append(sum, sizeof(sum));
+
+                auto now = std::chrono::steady_clock::now();
+                if (now - flushed >= std::chrono::milliseconds(STREAM_FLUSH_MS)) {
+                    SendResponseBody(sums.data(), sums.size());
+                    sums.clear();
+                    flushed = now;
+                }
+            }
+            info.Close();
+        } catch (const CppCommon::FileSystemException &ex) {
+            std::cout << "Block sum throw FS exception: " << ex.message() << std::endl;
+            // the body is shorter than its length, the client knows it by the close
+            Disconnect();
+            return;
+        }
+
+        if (!sums.empty())
+            SendResponseBody(sums.data(), sums.size());
+    }
+
+    // serve the small files in one response: [header][name][data] for every file.
+    void servePack(const std::string &body)
+    {
+        struct PackItem {
+            CppCommon::Path path;
+            std::string name;
+            PackHeader header;
+        };
+        std::vector<PackItem> items;
+        uint64_t total = 0;
+
+        // one base64 name per line
+        std::stringstream ss(body);
+        std::string line;
+        while (std::getline(ss, line, '\n')) {
+            if (line.empty())
+                continue;
+
+            PackItem item;
+            item.name = CppCommon::Encoding::Base64Decode(line);
+            item.path = _binder->getPath(item.name);
+            try {
+                if (item.path.empty() || !item.path.IsRegularFile()) {
+                    std::cout << "pack skip not found: " << item.name << std::endl;
+                    continue;
+                }
+                item.header.name_len = static_cast<uint32_t>(item.name.size());
+                item.header.mode = item.path.permissions().underlying();
+                item.header.mtime = item.path.modified().total();
+                item.header.size = CppCommon::File(item.path).size();
+            } catch (const CppCommon::FileSystemException &ex) {
+                std::cout << "pack skip FS exception: " << ex.message() << std::endl;
+                continue;
+            }
+            // it is read in once, the big one is downloaded by itself
+            if (item.header.size > PACK_FILE_MAX) {
+                std::cout << "pack skip big file: " << item.name << std::endl;
+                continue;
+            }
+
+            total += PACK_HEADER_SIZE + item.name.size() + item.header.size;
+            items.push_back(std::move(item));
+        }
+
+        response().Clear();
+        response().SetBegin(200);
+        response().SetHeader("Content-Type", "application/octet-stream");
+        response().SetBodyLength(total);
+
+        // send headers first
+        SendResponse(response());
+
+        if (_stream_buffer.size() < STREAM_BLOCK_SIZE)
+            _stream_buffer.resize(STREAM_BLOCK_SIZE);
+
+        // fill the stream buffer with records, send it while full.
+        char *buff = _stream_buffer.data();
+        size_t used = 0;
+        auto append = [&](const char *data, size_t size) {
+            while (size > 0) {
+                size_t num = std::min(size, STREAM_BLOCK_SIZE - used);
+                memcpy(buff + used, data, num);
+                used += num;
+                data += num;
+                size -= num;
+                if (used == STREAM_BLOCK_SIZE) {
+                    SendResponseBody(buff, used);
+                    used = 0;
+                }
+            }
+        };
+
+        for (const auto &item : items) {
+            char head[PACK_HEADER_SIZE];
+            item.header.encode(head);
+            append(head, PACK_HEADER_SIZE);
+            append(item.name.data(), item.name.size());
+
+            _handler(RES_OKHEADER, item.path.string().data(), item.header.size);
+
+            // the file is small, read it once. keep the declared size even if it has been changed.
+            std::string data(item.header.size, '\0');
+            try {
+                CppCommon::File file(item.path);
+                file.Open(true, false);
+                file.Read(data.data(), data.size());
+                file.Close();
+            } catch (const CppCommon::FileSystemException &ex) {
+                std::cout << "pack read FS exception: " << ex.message() << std::endl;
+            }
+            append(data.data(), data.size());
+
+            // return true to cancel download from outside.
+            bool cancel = _handler(RES_BODY, nullptr, data.size());
+            _handler(RES_FINISH, item.path.string().data(), item.header.size);
+            if (cancel) {
+                // the body is shorter than its length, the client knows it by the close
+                Disconnect();
+                return;
+            }
+        }
+
+        if (used > 0)
+            SendResponseBody(buff, used);
+    }
+
+    // send the body blocking, the cost measures the link speed.
+    void sendBody(const void *data, size_t size)
+    {
+        auto start = std::chrono::steady_clock::now();
+        SendResponseBody(data, size);
+        std::chrono::duration<double> cost = std::chrono::steady_clock::now() - start;
+        _deflate.onSent(size, cost.count());
+    }
+
+    // compress the data into the deflate buffer, return the compressed size or 0 if failed.
+    size_t deflateData(const char *data, size_t size)
+    {
+        uLongf zipped = compressBound(static_cast<uLong>(size));
+        if (_deflate_buffer.size() < zipped)
+            _deflate_buffer.resize(zipped);
+
+        auto start = std::chrono::steady_clock::now();
+        int ret = compress2(_deflate_buffer.data(), &zipped, reinterpret_cast<const Bytef *>(data),
+                            static_cast<uLong>(size), _deflate.level());
+        std::chrono::duration<double> cost = std::chrono::steady_clock::now() - start;
+        if (ret != Z_OK)
+            return 0;
+
+        _deflate.onCompressed(size, zipped, cost.count());
+        return zipped;
+    }
+
+    // read the window into the stream buffer, return the read size.
+    size_t readWindow(CppCommon::File &file, size_t length)
+    {
+        if (_stream_buffer.size() < length)
+            _stream_buffer.resize(length);
+
+        size_t read_sz = 0;
+        while (read_sz < length) {
+            size_t num = file.Read(_stream_buffer.data() + read_sz, length - read_sz);
+            if (num <= 0)
+                break;
+            read_sz += num;
+        }
+        return read_sz;
+    }
+
+    // estimate the ratio and speed by compressing the beginning of the window.
+    void probeWindow(CppCommon::File &file, size_t offset, size_t length)
+    {
+        size_t read_sz = readWindow(file, std::min<size_t>(length, COMPRESS_SAMPLE_SIZE));
+        deflateData(_stream_buffer.data(), read_sz);
+        file.Seek(offset);
+    }
+
+    // read the whole window and compress it.
+    // return the compressed size in deflate buffer, or 0 if it is not smaller than the raw.
+    size_t deflateWindow(CppCommon::File &file, size_t length, size_t &read_sz)
+    {
+        read_sz = readWindow(file, length);
+        size_t zipped = deflateData(_stream_buffer.data(), read_sz);
+        return zipped < read_sz ? zipped : 0;
+    }
+
+    // serve the file content from offset, or only the range [offset, offset + length) if length > 0.
+    // the range window may be compressed if the client accepts.
+    void serveContent(const CppCommon::Path &path, size_t offset, size_t length = 0, bool compress = false)
     {
         CppCommon::File info(path);
         if (info.IsExists()) {
             response().Clear();
-            response().SetBegin(200);
 
             if (info.IsDirectory()) {
+                response().SetBegin(200);
                 response().SetBodyLength(0);
                 response().SetBody("");
 
                 SendResponseAsync(response());
             } else if (info.IsRegularFile()){
-                info.Open(true, false);
+                // read into the stream buffer directly, without the file's own buffer copy
+                info.Open(true, false, false, CppCommon::File::DEFAULT_ATTRIBUTES, CppCommon::File::DEFAULT_PERMISSIONS, 0);
                 uint64_t total = 0;
 
                 size_t sz = info.size();
-                if (offset > 0 && offset < sz) {
+                if (offset > sz) {
+                    offset = sz;
+                }
+                if (offset > 0) {
                     //std::cout << "breakpoint continue transfer from:" << offset << std::endl;
                     info.Seek(offset); // seek to offset for breakpoint continue
                 }
 
+                bool ranged = length > 0;
+                if (!ranged || offset + length > sz) {
+                    length = sz - offset; // the remaining size
+                }
+
+                // the window is read whole before the headers, the compressed one is sent if smaller.
+                size_t buffered = 0, zipped = 0;
+                if (compress && ranged && length > 0 && length <= COMPRESS_WINDOW_SIZE
+                        && WebCompress::compressible(info.extension().string())) {
+                    _deflate.reset(info.string());
+                    if (_deflate.shouldProbe())
+                        probeWindow(info, offset, length);
+                    if (_deflate.shouldCompress())
+                        zipped = deflateWindow(info, length, buffered);
+                }
+
+                if (ranged && length > 0) {
+                    std::string range = "bytes " + std::to_string(offset) + "-" + std::to_string(offset + length - 1) + "/" + std::to_string(sz);
+                    response().SetBegin(206);
+                    response().SetHeader("Content-Range", range);
+                } else {
+                    response().SetBegin(200);
+                }
                 response().SetContentType(info.extension().string());
-                response().SetBodyLength(sz - offset); // set the remaining size as body lenght
+                if (zipped > 0) {
+                    response().SetHeader("Content-Encoding", COMPRESS_ENCODING);
+                    response().SetBodyLength(zipped);
+                } else {
+                    response().SetBodyLength(length);
+                }
 
-                total = response().body_length();
+                // the stripe of file: notify begin by the first one and finish by the last one.
+                bool first = !ranged || offset == 0;
+                bool last = !ranged || offset + length >= sz;
+                total = ranged ? sz : length;
 
                 // send headers first
                 SendResponse(response());
 
-                _handler(RES_OKHEADER, info.string().data(), total);
+                if (first)
+                    _handler(RES_OKHEADER, info.string().data(), total);
+
+                if (_stream_buffer.size() < STREAM_BLOCK_SIZE)
+                    _stream_buffer.resize(STREAM_BLOCK_SIZE);
 
                 bool cancel = false;
+                if (zipped > 0) {
+                    sendBody(_deflate_buffer.data(), zipped);
+                    cancel = _handler(RES_BODY, nullptr, buffered);
+                } else if (buffered > 0) {
+                    // the window has been read, but it is not worth to compress
+                    for (size_t pos = 0; !cancel && pos < buffered; pos += STREAM_BLOCK_SIZE) {
+                        size_t num = std::min<size_t>(STREAM_BLOCK_SIZE, buffered - pos);
+                        sendBody(_stream_buffer.data() + pos, num);
+                        cancel = _handler(RES_BODY, nullptr, num);
+                    }
+                }
+
                 size_t read_sz = 0;
-                char buff[BLOCK_SIZE];
-                while (!cancel) {
-                    memset(buff, 0, BLOCK_SIZE);
-                    read_sz = info.Read(buff, sizeof(buff));
+                size_t remain = buffered > 0 ? 0 : length;
+                // align the first chunk to block boundary, the following reads are all aligned.
+                size_t chunk = STREAM_BLOCK_SIZE - (offset % BLOCK_SIZE);
+                while (!cancel && remain > 0) {
+                    read_sz = info.Read(_stream_buffer.data(), std::min(remain, chunk));
                     if (read_sz <= 0) {
                         break;
                     }
-                    SendResponseBody(buff, read_sz);
+                    remain -= read_sz;
+                    chunk = STREAM_BLOCK_SIZE;
+                    sendBody(_stream_buffer.data(), read_sz);
                     // notify progress：size total
                     // return true to cancel download from outside.
                     cancel = _handler(RES_BODY, nullptr, read_sz);
@@ -112,7 +512,8 @@ protected:
 
                 info.Close();
 
-                _handler(RES_FINISH, info.string().data(), total);
+                if (last)
+                    _handler(RES_FINISH, info.string().data(), total);
             } else {
                 std::cout << "this is link file: " << path.absolute() << std::endl;
             }
@@ -176,14 +577,14 @@ protected:
                 _handler(RES_WEB_FINISH, nullptr, 0);
             } else if (method == s_headerInfos[INFO_WEB_INDEX]) {
                 std::string name = key.substr(dePos + 1);
-                CppCommon::Path diskpath = WebBinder::GetInstance().getPath(name);
+                CppCommon::Path diskpath = _binder->getPath(name);
                 if (diskpath.empty()) {
                     std::cout << "webindex : " << name << " > " << diskpath.string() << std::endl;
                     SendResponseAsync(response().MakeErrorResponse(404, "Not found."));
                     return;
                 }
 
-                bool found = WebBinder::GetInstance().containWeb(key);
+                bool found = _binder->containWeb(key);
                 if (found) {
                     // this web index changed
                     _handler(RES_INDEX_CHANGE, diskpath.string().data(), 0);
@@ -193,7 +594,11 @@ protected:
             SendResponseAsync(response().MakeHeadResponse());
         } else if (request.method() == "GET") {
             // std::string url = "info/pathname&token=xxx";
+            // std::string url = "manifest/pathname&token=xxx";
+            // std::string url = "blocksum/pathname&token=xxx";
             // std::string url = "download/pathname&token=xxx&offset=xxx";
+            // std::string url = "download/pathname&token=xxx&offset=xxx&range=<start>-<end>";
+            // std::string url = "download/pathname&token=xxx&offset=xxx&range=<start>-<end>&compress=deflate";
             std::string url = std::string(request.url());
 
             size_t pathEnd = url.find("&token");
@@ -211,8 +616,8 @@ protected:
             std::string method = path.substr(0, path.find('/'));
 
             // 检查token是否正确
-            if (TokenCache::GetInstance().verifyToken(token)) {
-                CppCommon::Path diskpath = WebBinder::GetInstance().getPath(name);
+            if (authorized(token)) {
+                CppCommon::Path diskpath = _binder->getPath(name);
 
                 if (diskpath.empty()) {
                     std::cout << "request >> name: " << name << " > " << diskpath.string() << std::endl;
@@ -224,6 +629,12 @@ protected:
                 if (method.find("info") != std::string::npos) {
                     // 处理predownload请求的name
                     serveInfo(diskpath);
+                } else if (method.find("manifest") != std::string::npos) {
+                    // the whole tree of the dir
+                    serveManifest(diskpath);
+                } else if (method.find("blocksum") != std::string::npos) {
+                    // the block hashes of the file
+                    serveBlockSum(diskpath);
                 } else if (method.find("download") != std::string::npos) {
                     // 处理download请求的name
                     std::string offstr = queryParams["offset"];
@@ -232,7 +643,25 @@ protected:
                         offset = std::stoll(offstr);
                     }
 
-                    serveContent(diskpath, offset);
+                    // the byte range, both start and end are included.
+                    size_t length = 0;
+                    std::string rangestr = queryParams["range"];
+                    size_t sepPos = rangestr.find('-');
+                    if (sepPos != std::string::npos) {
+                        try {
+                            size_t start = std::stoull(rangestr.substr(0, sepPos));
+                            size_t end = std::stoull(rangestr.substr(sepPos + 1));
+                            if (end >= start) {
+                                offset = start;
+                                length = end - start + 1;
+                            }
+                        } catch (const std::exception &ex) {
+                            std::cout << "Invalid range: " << rangestr << std::endl;
+                        }
+                    }
+
+                    bool compress = queryParams["compress"] == COMPRESS_ENCODING;
+                    serveContent(diskpath, offset, length, compress);
                 } else {
                     SendResponseAsync(response().MakeErrorResponse("Unsupported HTTP request: " + method));
                 }
@@ -241,6 +670,27 @@ protected:
                 // Response reject
                 SendResponseAsync(response().MakeErrorResponse(404, "Invalid auth token!"));
             }
+        } else if (request.method() == "POST") {
+            // std::string url = "pack/&token=xxx"; body: base64 names, one per line
+            std::string url = std::string(request.url());
+
+            size_t queryStart = url.find("&token");
+            if (queryStart == std::string::npos) {
+                SendResponseAsync(response().MakeErrorResponse(404, "Invalid auth token!"));
+                return;
+            }
+            std::string method = url.substr(0, url.find('/'));
+            std::unordered_map<std::string, std::string> queryParams = parseQueryParams(url.substr(queryStart + 1));
+            std::string token = queryParams["token"];
+
+            if (!authorized(token)) {
+                std::cout << "Token invalid" << std::endl;
+                SendResponseAsync(response().MakeErrorResponse(404, "Invalid auth token!"));
+            } else if (method == "pack") {
+                servePack(std::string(request.body()));
+            } else {
+                SendResponseAsync(response().MakeErrorResponse("Unsupported HTTP request: " + method));
+            }
         } else
             SendResponseAsync(response().MakeErrorResponse("Unsupported HTTP method: " + std::string(request.method())));
     }
@@ -259,6 +709,15 @@ protected:
 
 private:
     ResponseHandler _handler { nullptr };
+    std::shared_ptr<WebBinder> _binder;
+    std::string _token;
+    std::chrono::system_clock::time_point _token_expires;
+
+    // reused by all files served in this session
+    std::vector<char> _stream_buffer;
+    std::vector<Bytef> _deflate_buffer;
+    AdaptiveDeflate _deflate;
+    std::chrono::steady_clock::time_point _manifest_flushed;
 };
 
 std::shared_ptr<CppServer::Asio::SSLSession>
@@ -268,25 +727,25 @@ FileServer::CreateSession(const std::shared_ptr<CppServer::Asio::SSLServer> &ser
         if (_callback) {
             if (RES_OKHEADER == status) {
                 std::string path(buffer);
-                _callback->onWebChanged(WEB_FILE_BEGIN, path, size);
+                notifyChanged(WEB_FILE_BEGIN, path, size);
             } else if (RES_BODY == status) {
                 // return true to canceled from outside.
-                return _callback->onProgress(size);
+                return notifyProgress(size);
             } else if (RES_FINISH == status) {
                 std::string path(buffer);
-                _callback->onWebChanged(WEB_FILE_END, path, size);
+                notifyChanged(WEB_FILE_END, path, size);
             } else if (RES_NOTFOUND == status) {
                 std::string path(buffer);
-                _callback->onWebChanged(WEB_NOT_FOUND, "not_found");
+                notifyChanged(WEB_NOT_FOUND, "not_found");
             } else if (RES_ERROR == status) {
-                _callback->onWebChanged(WEB_DISCONNECTED, "net_error");
+                notifyChanged(WEB_DISCONNECTED, "net_error");
             } else if (RES_INDEX_CHANGE == status) {
                 std::string path(buffer);
-                _callback->onWebChanged(WEB_INDEX_BEGIN, path);
+                notifyChanged(WEB_INDEX_BEGIN, path);
             } else if (RES_WEB_START == status) {
-                _callback->onWebChanged(WEB_TRANS_START);
+                notifyChanged(WEB_TRANS_START);
             } else if (RES_WEB_FINISH == status) {
-                _callback->onWebChanged(WEB_TRANS_FINISH);
+                notifyChanged(WEB_TRANS_FINISH);
             }
         }
         return _stop.load();
@@ -294,6 +753,7 @@ FileServer::CreateSession(const std::shared_ptr<CppServer::Asio::SSLServer> &ser
 
     auto session = std::make_shared<HTTPFileSession>(std::dynamic_pointer_cast<CppServer::HTTP::HTTPSServer>(server));
     session->setResponseHandler(std::move(cb));
+    session->setBinder(_binder);
     return session;
 }
 
@@ -307,6 +767,8 @@ bool FileServer::start()
     _stop.store(false);
     SetupReuseAddress(true);
     SetupReusePort(true);
+    // the response header and body are sent in two writes, do not wait for the ack.
+    SetupNoDelay(true);
     return IsStarted() ? Restart() : Start();
 }
 
@@ -327,7 +789,7 @@ bool FileServer::stop()
 //    "/images/2022/" -> C:/Users/username/Pictures/2022/
 int FileServer::webBind(std::string webDir, std::string diskDir)
 {
-    int bind =  WebBinder::GetInstance().bind(webDir, diskDir);
+    int bind =  _binder->bind(webDir, diskDir);
     if (bind == -1) throw std::invalid_argument("Web binding exists.");
     if (bind == -2) throw std::invalid_argument("Not a valid web path.");
     if (bind == -3) throw std::invalid_argument("Not a valid disk path.");
@@ -337,12 +799,12 @@ int FileServer::webBind(std::string webDir, std::string diskDir)
 
 int FileServer::webUnbind(std::string webDir)
 {
-    return WebBinder::GetInstance().unbind(webDir);
+    return _binder->unbind(webDir);
 }
 
 void FileServer::clearBind()
 {
-    WebBinder::GetInstance().clear();
+    _binder->clear();
 }
 
 std::string FileServer::genToken(std::string info)
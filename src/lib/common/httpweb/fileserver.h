@@ -7,6 +7,7 @@
 
 #include "server/http/https_server.h"
 #include "syncstatus.h"
+#include "webbinder.h"
 
 class FileServer : public WebInterface, public CppServer::HTTP::HTTPSServer
 {
@@ -30,6 +31,8 @@ protected:
 
 private:
     std::atomic<bool> _stop { false };
+    // the binds of this server's transfer, shared with its sessions
+    std::shared_ptr<WebBinder> _binder { std::make_shared<WebBinder>() };
 };
 
 #endif // FILESERVER_H
@@ -8,9 +8,47 @@
 #include <memory>
 #include <functional>
 #include <string>
+#include <mutex>
 
 #define BLOCK_SIZE 4096
 
+// the chunk size to stream file content, multiple of BLOCK_SIZE
+#define STREAM_BLOCK_SIZE (256 * BLOCK_SIZE)
+
+// the default count of parallel download connections
+#define DOWNLOAD_CONNECTIONS 4
+
+// the min size of one stripe, split big file into stripes and download them in parallel
+#define STRIPE_MIN_SIZE (16 * 1024 * 1024)
+
+// the files smaller than this are packed into one request
+#define PACK_FILE_MAX (64 * 1024)
+// the max bytes and files of one pack request
+#define PACK_BATCH_SIZE (4 * 1024 * 1024)
+#define PACK_BATCH_COUNT 512
+
+// the walked manifest lines and the block sums are sent at least every this time (ms)
+#define STREAM_FLUSH_MS 200
+
+// the block size to compare the changed big file in incremental sync
+#define DELTA_BLOCK_SIZE (1024 * 1024)
+// the exist file not smaller than this is patched by the changed blocks
+#define DELTA_MIN_SIZE (4 * DELTA_BLOCK_SIZE)
+
+// the compressible file is downloaded by windows, each one may be compressed or not
+#define COMPRESS_MIN_SIZE (1024 * 1024)
+#define COMPRESS_WINDOW_SIZE (8 * 1024 * 1024)
+// estimate the compression by the sample, probe again after skipped some windows
+#define COMPRESS_SAMPLE_SIZE (256 * 1024)
+#define COMPRESS_PROBE_INTERVAL 8
+
+// flush the downloading file and record the written range into journal every this size,
+// the broken file not smaller than this is resumed from the journal.
+#define CHECKPOINT_SIZE (32 * 1024 * 1024)
+
+// give up the request if no data arrived in this time (ms)
+#define DOWNLOAD_IDLE_TIMEOUT 5000
+
 static const std::string s_headerInfos[] = {"webstart", "webfinish", "webindex"};
 
 enum INFOHEAD {
@@ -70,7 +108,24 @@ public:
     }
 
 protected:
+    // the state may be changed from many connections, notify them one by one.
+    void notifyChanged(int state, const std::string &msg = "", uint64_t size = 0)
+    {
+        std::lock_guard<std::mutex> locker(_notify_lock);
+        if (_callback)
+            _callback->onWebChanged(state, msg, size);
+    }
+
+    // return true to cancel from outside.
+    bool notifyProgress(uint64_t size)
+    {
+        return _callback ? _callback->onProgress(size) : false;
+    }
+
     std::shared_ptr<ProgressCallInterface> _callback { nullptr };
+
+private:
+    std::mutex _notify_lock;
 };
 
 
@@ -8,6 +8,11 @@
 
 #include "configs/crypt/cert.h"
 
+#include <openssl/sha.h>
+
+// the tokens are issued per transfer, a few are alive at the same time
+#define MAX_CACHED_TOKENS 1024
+
 std::string TokenCache::genToken(std::string info)
 {
     const std::string es256k_priv_key = Cert::instance()->getPriEs256k();
@@ -27,24 +32,84 @@ std::string TokenCache::genToken(std::string info)
 
 bool TokenCache::verifyToken(std::string &token)
 {
-    const std::string es256k_priv_key = Cert::instance()->getPriEs256k();
-    const std::string es256k_pub_key = Cert::instance()->getPubEs256k();
-    auto verifier = jwt::verify()
-                          .allow_algorithm(jwt::algorithm::es256k(es256k_pub_key, es256k_priv_key, "", ""))
+    return verifyToken(token, nullptr);
+}
+
+bool TokenCache::verifyToken(const std::string &token, std::chrono::system_clock::time_point *expires)
+{
+    if (token.empty())
+        return false;
+
+    std::string key = digest(token);
+    if (lookup(key, expires))
+        return true;
+
+    // the keys are fixed, build the verifier only once
+    static const auto verifier = jwt::verify()
+                          .allow_algorithm(jwt::algorithm::es256k(Cert::instance()->getPubEs256k(),
+                                                                  Cert::instance()->getPriEs256k(), "", ""))
                           .with_issuer("deepin");
 
+    std::chrono::system_clock::time_point exp = std::chrono::system_clock::time_point::max();
     try {
         auto decoded = jwt::decode(token);
         verifier.verify(decoded);
+        if (decoded.has_expires_at())
+            exp = decoded.get_expires_at();
         //std::cout << "Token verify success!" << std::endl;
     } catch (const std::exception& ex) {
         std::cout << "Error: " << ex.what() << std::endl;
         return false;
     }
 
+    store(key, exp);
+    if (expires)
+        *expires = exp;
+    return true;
+}
+
+std::string TokenCache::digest(const std::string &token)
+{
+    // a cryptographic digest, a forged token must not hit the cache by collision
+    unsigned char md[SHA256_DIGEST_LENGTH];
+    SHA256(reinterpret_cast<const unsigned char *>(token.data()), token.size(), md);
+    return std::string(reinterpret_cast<const char *>(md), SHA256_DIGEST_LENGTH);
+}
+
+bool TokenCache::lookup(const std::string &key, std::chrono::system_clock::time_point *expires)
+{
+    std::lock_guard<std::mutex> lock(_cache_lock);
+    auto it = _cache.find(key);
+    if (it == _cache.end())
+        return false;
+
+    if (it->second <= std::chrono::system_clock::now()) {
+        _cache.erase(it);
+        return false;
+    }
+    if (expires)
+        *expires = it->second;
     return true;
 }
 
+void TokenCache::store(const std::string &key, std::chrono::system_clock::time_point expires)
+{
+    std::lock_guard<std::mutex> lock(_cache_lock);
+    if (_cache.size() >= MAX_CACHED_TOKENS) {
+        // drop the expired first, then all
+        auto now = std::chrono::system_clock::now();
+        for (auto it = _cache.begin(); it != _cache.end();) {
+            if (it->second <= now)
+                it = _cache.erase(it);
+            else
+                ++it;
+        }
+        if (_cache.size() >= MAX_CACHED_TOKENS)
+            _cache.clear();
+    }
+    _cache[key] = expires;
+}
+
 std::vector<std::string> TokenCache::getWebfromToken(const std::string &token)
 {
     auto decoded = jwt::decode(token);
@@ -8,6 +8,7 @@
 #include "string/string_utils.h"
 #include "utility/singleton.h"
 
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <mutex>
@@ -20,12 +21,20 @@ public:
     std::string genToken(std::string info);
 
     bool verifyToken(std::string &token);
+    // verify the token and get its expiry. The verified tokens are cached by their digest until
+    // expired, so the same token is only decoded and checked by signature once.
+    bool verifyToken(const std::string &token, std::chrono::system_clock::time_point *expires);
 
     std::vector<std::string> getWebfromToken(const std::string &token);
 
 private:
+    std::string digest(const std::string &token);
+    bool lookup(const std::string &key, std::chrono::system_clock::time_point *expires);
+    void store(const std::string &key, std::chrono::system_clock::time_point expires);
+
     std::mutex _cache_lock;
-    std::map<std::string, std::string, std::less<>> _cache;
+    // <sha256 of token, expires>
+    std::map<std::string, std::chrono::system_clock::time_point, std::less<>> _cache;
 };
 
 #endif // TOKENCACHE_H
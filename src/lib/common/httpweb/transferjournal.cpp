@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "transferjournal.h"
+
+#include "filesystem/directory.h"
+#include "filesystem/path.h"
+
+#include <iostream>
+
+TransferJournal::~TransferJournal()
+{
+    close();
+}
+
+void TransferJournal::open(const std::string &savedir)
+{
+    close();
+
+    std::lock_guard<std::mutex> locker(_lock);
+    _folders.clear();
+    _names.clear();
+    _files.clear();
+
+    CppCommon::Path path = CppCommon::Path(savedir) / JOURNAL_NAME;
+    try {
+        if (path.IsRegularFile()) {
+            for (const auto &line : CppCommon::File::ReadAllLines(path)) {
+                picojson::value v;
+                if (line.empty() || !picojson::parse(v, line).empty())
+                    continue; // the last line may be broken
+                apply(v);
+            }
+        }
+
+        CppCommon::Directory::CreateTree(path.parent());
+        // write into system directly, the file data is flushed before its record.
+        _file = CppCommon::File(path);
+        _file.OpenOrCreate(false, true, false, CppCommon::File::DEFAULT_ATTRIBUTES, CppCommon::File::DEFAULT_PERMISSIONS, 0);
+        _file.Seek(_file.size());
+    } catch (const CppCommon::FileSystemException &ex) {
+        std::cout << "Open journal throw FS exception: " << ex.message() << std::endl;
+    }
+}
+
+void TransferJournal::close()
+{
+    std::lock_guard<std::mutex> locker(_lock);
+    if (_file.IsFileOpened()) {
+        try {
+            _file.Close();
+        } catch (const CppCommon::FileSystemException &ex) {
+            std::cout << "Close journal throw FS exception: " << ex.message() << std::endl;
+        }
+    }
+}
+
+void TransferJournal::clear()
+{
+    close();
+
+    std::lock_guard<std::mutex> locker(_lock);
+    _folders.clear();
+    _names.clear();
+    _files.clear();
+    try {
+        if (!_file.empty() && _file.IsExists())
+            CppCommon::File::Remove(_file);
+    } catch (const CppCommon::FileSystemException &ex) {
+        std::cout << "Remove journal throw FS exception: " << ex.message() << std::endl;
+    }
+}
+
+bool TransferJournal::isOpened()
+{
+    std::lock_guard<std::mutex> locker(_lock);
+    return _file.IsFileOpened();
+}
+
+std::string TransferJournal::findFolder(const std::string &name)
+{
+    std::lock_guard<std::mutex> locker(_lock);
+    auto it = _folders.find(name);
+    return it == _folders.end() ? "" : it->second;
+}
+
+void TransferJournal::addFolder(const std::string &name, const std::string &path)
+{
+    picojson::object record;
+    record["t"] = picojson::value("dir");
+    record["name"] = picojson::value(name);
+    record["path"] = picojson::value(path);
+
+    std::lock_guard<std::mutex> locker(_lock);
+    apply(picojson::value(record));
+    append(record, false);
+}
+
+bool TransferJournal::findFile(const std::string &name, int64_t size, int64_t mtime, JournalFile &file)
+{
+    std::lock_guard<std::mutex> locker(_lock);
+    auto it = _names.find(name);
+    if (it == _names.end())
+        return false;
+
+    auto found = _files.find(it->second);
+    if (found == _files.end() || found->second.size != size || found->second.mtime != mtime)
+        return false;
+
+    file = found->second;
+    return true;
+}
+
+void TransferJournal::addFile(const std::string &name, const std::string &path, int64_t size, int64_t mtime)
+{
+    picojson::object record;
+    record["t"] = picojson::value("file");
+    record["name"] = picojson::value(name);
+    record["path"] = picojson::value(path);
+    record["size"] = picojson::value(size);
+    record["mtime"] = picojson::value(mtime);
+
+    std::lock_guard<std::mutex> locker(_lock);
+    apply(picojson::value(record));
+    append(record, false);
+}
+
+void TransferJournal::commit(const std::string &path, uint64_t offset, uint64_t length, uint64_t hash)
+{
+    picojson::object record;
+    record["t"] = picojson::value("part");
+    record["path"] = picojson::value(path);
+    record["offset"] = picojson::value(static_cast<int64_t>(offset));
+    record["length"] = picojson::value(static_cast<int64_t>(length));
+    // the json number is signed, keep the hash in hex
+    char hex[17];
+    snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+    record["hash"] = picojson::value(std::string(hex));
+
+    std::lock_guard<std::mutex> locker(_lock);
+    apply(picojson::value(record));
+    append(record, true);
+}
+
+void TransferJournal::finish(const std::string &path)
+{
+    picojson::object record;
+    record["t"] = picojson::value("done");
+    record["path"] = picojson::value(path);
+
+    std::lock_guard<std::mutex> locker(_lock);
+    apply(picojson::value(record));
+    append(record, false);
+}
+
+std::vector<JournalPart> TransferJournal::parts(const std::string &path)
+{
+    std::lock_guard<std::mutex> locker(_lock);
+    auto it = _files.find(path);
+    return it == _files.end() ? std::vector<JournalPart>() : it->second.parts;
+}
+
+void TransferJournal::apply(const picojson::value &record)
+{
+    std::string type = record.get("t").to_str();
+    std::string path = record.get("path").to_str();
+    if (type == "dir") {
+        _folders[record.get("name").to_str()] = path;
+    } else if (type == "file") {
+        JournalFile file;
+        file.path = path;
+        if (record.get("size").is<int64_t>())
+            file.size = record.get("size").get<int64_t>();
+        if (record.get("mtime").is<int64_t>())
+            file.mtime = record.get("mtime").get<int64_t>();
+        _names[record.get("name").to_str()] = path;
+        _files[path] = file; // the new download replaces the old one
+    } else if (type == "part") {
+        auto it = _files.find(path);
+        if (it == _files.end() || !record.get("offset").is<int64_t>() || !record.get("length").is<int64_t>())
+            return;
+        JournalPart part;
+        part.offset = static_cast<uint64_t>(record.get("offset").get<int64_t>());
+        part.length = static_cast<uint64_t>(record.get("length").get<int64_t>());
+        part.hash = std::strtoull(record.get("hash").to_str().c_str(), nullptr, 16);
+        it->second.parts.push_back(part);
+    } else if (type == "done") {
+        auto it = _files.find(path);
+        if (it != _files.end())
+            it->second.done = true;
+    }
+}
+
+void TransferJournal::append(const picojson::object &record, bool sync)
+{
+    if (!_file.IsFileOpened())
+        return;
+
+    std::string line = picojson::value(record).serialize();
+    line.append("\n");
+    try {
+        _file.Write(line.data(), line.size());
+        if (sync)
+            _file.Flush();
+    } catch (const CppCommon::FileSystemException &ex) {
+        std::cout << "Write journal throw FS exception: " << ex.message() << std::endl;
+    }
+}
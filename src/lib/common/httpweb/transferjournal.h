@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef TRANSFERJOURNAL_H
+#define TRANSFERJOURNAL_H
+
+#include "filesystem/file.h"
+
+#include "webproto.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// the journal file in the save dir, removed after the whole download finished.
+#define JOURNAL_NAME ".transfer.journal"
+
+// the committed range of the downloading file and its hash
+struct JournalPart {
+    uint64_t offset {0};
+    uint64_t length {0};
+    uint64_t hash {0};
+};
+
+struct JournalFile {
+    std::string path; // the local save path
+    int64_t size {0};
+    int64_t mtime {0};
+    bool done {false};
+    std::vector<JournalPart> parts;
+};
+
+// The checkpoint journal of download: the local path of every save name and the committed
+// ranges of every file, appended as one json line per record. The broken download resumes by it.
+class TransferJournal
+{
+public:
+    ~TransferJournal();
+
+    // load the exist journal in the save dir, then append new records to it.
+    void open(const std::string &savedir);
+    void close();
+    // the whole download has finished, remove the journal.
+    void clear();
+    bool isOpened();
+
+    std::string findFolder(const std::string &name);
+    void addFolder(const std::string &name, const std::string &path);
+
+    // find the record of the same file, return false if not found.
+    bool findFile(const std::string &name, int64_t size, int64_t mtime, JournalFile &file);
+    void addFile(const std::string &name, const std::string &path, int64_t size, int64_t mtime);
+    // the range has been flushed into the file
+    void commit(const std::string &path, uint64_t offset, uint64_t length, uint64_t hash);
+    void finish(const std::string &path);
+    // the committed ranges of the file
+    std::vector<JournalPart> parts(const std::string &path);
+
+private:
+    void apply(const picojson::value &record);
+    void append(const picojson::object &record, bool sync);
+
+    std::mutex _lock;
+    CppCommon::File _file;
+    std::map<std::string, std::string> _folders; // save name : local path
+    std::map<std::string, std::string> _names; // save name : local path
+    std::map<std::string, JournalFile> _files; // local path : file
+};
+
+#endif // TRANSFERJOURNAL_H
@@ -4,46 +4,103 @@
 
 #include "webbinder.h"
 
-#include <regex>
+#include <mutex>
 
 WebBinder::WebBinder()
 {
 
 }
 
-int WebBinder::bind(std::string webDir, std::string diskDir)
+std::vector<std::string_view> WebBinder::split(std::string_view path)
 {
-    // std::regex validateWeb(R"([^\0<>:"/\\|?*]*$)");
-    // std::regex validateDisk(R"((\/)?(?![.]{1,2}($|\/))[\w.-]+(\/[\w.-]+)*(\\.[\w]+)?)");
-    std::regex isFile(R"(\S*\/$)");
-
-    // std::regex validateWeb(R"([^\0<>:"/\\|?*]*$)"), validateDisk("(\\/)?((\\w)+(\\/)?)*(\\.(\\w)+)?"), isFile("\\S*\\/");
-    // std::regex validateWeb("(\\/((\\w)*|\\*))*"), validateDisk("(\\/)?((\\w)+(\\/)?)*(\\.(\\w)+)?"), isFile("\\S*\\/");
-
-    // if (!std::regex_match(webDir, validateWeb)) return -2;
-    // if (!std::regex_match(diskDir, validateDisk)) return -3;
-    if (std::regex_match(webDir, isFile) != std::regex_match(diskDir, isFile)) return -4;
+    // "dir/" binds the same node as "dir", the slash is checked on lookup
+    if (!path.empty() && path.back() == '/')
+        path.remove_suffix(1);
+
+    std::vector<std::string_view> parts;
+    if (path.empty())
+        return parts;
+
+    size_t start = 0;
+    while (true) {
+        size_t end = path.find('/', start);
+        if (end == std::string_view::npos) {
+            parts.push_back(path.substr(start));
+            break;
+        }
+        parts.push_back(path.substr(start, end - start));
+        start = end + 1;
+    }
+    return parts;
+}
 
-    for (auto &pair : _binds) if (pair.first.compare(webDir) == 0) return -1;
+int WebBinder::bind(std::string webDir, std::string diskDir)
+{
+    // both are dirs (end with '/') or neither
+    bool webIsDir = !webDir.empty() && webDir.back() == '/';
+    bool diskIsDir = !diskDir.empty() && diskDir.back() == '/';
+    if (webIsDir != diskIsDir) return -4;
+
+    std::unique_lock<std::shared_mutex> lock(_lock);
+    Node *node = &_root;
+    for (const auto &part : split(webDir)) {
+        auto it = node->children.find(part);
+        if (it == node->children.end())
+            it = node->children.emplace(std::string(part), std::make_unique<Node>()).first;
+        node = it->second.get();
+    }
+    if (node->bound) return -1;
 
-    _binds.insert(_binds.begin(), std::make_pair(webDir, diskDir));
+    node->bound = true;
+    node->web = webDir;
+    node->disk = diskDir;
+    _binds.insert(_binds.begin(), webDir);
 
     return 0;
 }
 
 int WebBinder::unbind(std::string webDir)
 {
+    std::unique_lock<std::shared_mutex> lock(_lock);
+    std::vector<std::pair<Node *, std::string_view>> trail;
+    Node *node = &_root;
+    for (const auto &part : split(webDir)) {
+        auto it = node->children.find(part);
+        if (it == node->children.end())
+            return -1;
+        trail.emplace_back(node, part);
+        node = it->second.get();
+    }
+    if (!node->bound || node->web != webDir)
+        return -1;
+
+    node->bound = false;
+    node->web.clear();
+    node->disk.clear();
+    // prune the nodes left without binds
+    while (!trail.empty() && !node->bound && node->children.empty()) {
+        Node *parent = trail.back().first;
+        parent->children.erase(parent->children.find(trail.back().second));
+        trail.pop_back();
+        node = parent;
+    }
+
     for (size_t i = 0; i < _binds.size(); i++) {
-        if (_binds[i].first.compare(webDir) == 0) {
+        if (_binds[i] == webDir) {
             _binds.erase(_binds.begin() + i);
-            return 0;
+            break;
         }
     }
-    return -1;
+    return 0;
 }
 
 void WebBinder::clear()
 {
+    std::unique_lock<std::shared_mutex> lock(_lock);
+    _root.bound = false;
+    _root.web.clear();
+    _root.disk.clear();
+    _root.children.clear();
     _binds.clear();
 }
 
@@ -52,21 +109,39 @@ std::string WebBinder::getPath(std::string path)
     if (path.empty()) {
         return "";
     }
-    for (auto &pair : _binds) {
-        const std::string& virtualBind = pair.first;
-        if (path.find(virtualBind) == 0) {
-            std::string rest = path.substr(virtualBind.length()); // 获取虚拟路径中与绑定路径匹配部分之外的部分
-            return pair.second + rest; // 返回对应的物理路径
-        }
+
+    std::shared_lock<std::shared_mutex> lock(_lock);
+    auto matched = [&path](const Node *node) {
+        return node->bound && path.compare(0, node->web.size(), node->web) == 0;
+    };
+
+    const Node *found = matched(&_root) ? &_root : nullptr;
+    const Node *node = &_root;
+    std::string_view rest(path);
+    while (!rest.empty()) {
+        size_t end = rest.find('/');
+        auto it = node->children.find(rest.substr(0, end));
+        if (it == node->children.end())
+            break;
+        node = it->second.get();
+        if (matched(node))
+            found = node;
+        if (end == std::string_view::npos)
+            break;
+        rest.remove_prefix(end + 1);
     }
+    if (!found)
+        return "";
 
-    return "";
+    std::string remain = path.substr(found->web.length()); // 获取虚拟路径中与绑定路径匹配部分之外的部分
+    return found->disk + remain; // 返回对应的物理路径
 }
 
 bool WebBinder::containWeb(const std::string &name)
 {
-    for (auto &pair : _binds) {
-        if (pair.first.find(name) != std::string::npos) {
+    std::shared_lock<std::shared_mutex> lock(_lock);
+    for (auto &web : _binds) {
+        if (web.find(name) != std::string::npos) {
             return true;
         }
     }
@@ -76,9 +151,10 @@ bool WebBinder::containWeb(const std::string &name)
 
 bool WebBinder::lastWeb(const std::string &name)
 {
+    std::shared_lock<std::shared_mutex> lock(_lock);
     if (!_binds.empty()) {
-        auto lastElement = _binds.back();
-        if (name.find(lastElement.first) != std::string::npos) {
+        const auto &lastElement = _binds.back();
+        if (name.find(lastElement) != std::string::npos) {
             return true;
         }
     }
@@ -5,15 +5,20 @@
 #ifndef WEBBINDER_H
 #define WEBBINDER_H
 
-#include "utility/singleton.h"
-
+#include <map>
+#include <memory>
+#include <shared_mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <utility>
 
-class WebBinder : public CppCommon::Singleton<WebBinder>
+// The web names of one transfer bound to the disk paths. The binds are indexed by the path
+// components, a lookup walks the components of the name once and the longest bound prefix wins.
+// Each file server owns its binder, the sessions resolve the names concurrently under a shared
+// lock while the binds change rarely.
+class WebBinder
 {
-    friend CppCommon::Singleton<WebBinder>;
 public:
     WebBinder();
 
@@ -25,10 +30,22 @@ public:
     bool lastWeb(const std::string &name);
 
 private:
+    struct Node {
+        bool bound { false };
+        std::string web; // the bound web path as it was bound
+        std::string disk;
+        std::map<std::string, std::unique_ptr<Node>, std::less<>> children;
+    };
+
+    static std::vector<std::string_view> split(std::string_view path);
+
     void replaceAll(std::string &str, const std::string &from, const std::string &to);
     bool replace(std::string &str, const std::string &from, const std::string &to);
 
-    std::vector<std::pair<std::string, std::string>> _binds;
+    std::shared_mutex _lock;
+    Node _root;
+    // the web paths in bind order, newest first
+    std::vector<std::string> _binds;
 };
 
 #endif // WEBBINDER_H
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef WEBCOMPRESS_H
+#define WEBCOMPRESS_H
+
+#include "syncstatus.h"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+#include "zlib.h"
+
+// the content-encoding of the compressed window, zlib format
+#define COMPRESS_ENCODING "deflate"
+
+namespace WebCompress {
+
+// the already compressed formats, never try to compress them again
+inline bool compressible(const std::string &extension)
+{
+    static const char *s_skips[] = {
+        ".jpg", ".jpeg", ".png", ".gif", ".webp", ".heic", ".mp3", ".mp4", ".mkv", ".avi", ".mov", ".flac", ".aac", ".ogg",
+        ".zip", ".gz", ".tgz", ".bz2", ".xz", ".7z", ".rar", ".zst", ".lz4", ".deb", ".rpm", ".apk", ".jar", ".iso",
+        ".docx", ".xlsx", ".pptx", ".odt", ".ods", ".odp", ".pdf", ".epub"
+    };
+
+    std::string ext = extension;
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return std::tolower(c); });
+    for (const char *skip : s_skips) {
+        if (ext == skip)
+            return false;
+    }
+    return true;
+}
+
+} // namespace WebCompress
+
+// Decide whether compress the next window by the measured ratio and speeds: the window is
+// compressed and then sent, it is worth only if (1 / deflate + ratio / link) < (1 / link).
+class AdaptiveDeflate
+{
+public:
+    // start a new file, its content is unknown now.
+    void reset(const std::string &path)
+    {
+        if (path == _path)
+            return;
+        _path = path;
+        _ratio = 0;
+        _skipped = 0;
+    }
+
+    // estimate the content by a sample while it is unknown, or again after skipped some windows.
+    bool shouldProbe()
+    {
+        if (_ratio <= 0 || _skipped >= COMPRESS_PROBE_INTERVAL) {
+            _skipped = 0;
+            return true;
+        }
+        return false;
+    }
+
+    bool shouldCompress()
+    {
+        bool worth = false;
+        if (_ratio > 0 && _ratio < 0.9) {
+            // compress it until the speeds have been measured
+            worth = _deflate_rate <= 0 || _link_rate <= 0
+                    || 1.0 / _deflate_rate + _ratio / _link_rate < 1.0 / _link_rate;
+        }
+        if (!worth)
+            _skipped++;
+        return worth;
+    }
+
+    int level() const
+    {
+        return _level;
+    }
+
+    // the window has been compressed: input bytes, output bytes and the cost seconds
+    void onCompressed(size_t input, size_t output, double seconds)
+    {
+        if (input == 0)
+            return;
+        _ratio = static_cast<double>(output) / input;
+        if (seconds > 0)
+            _deflate_rate = average(_deflate_rate, input / seconds);
+
+        // raise the level while the link is the bottleneck, lower it while the cpu is.
+        if (_link_rate > 0 && _deflate_rate > 0) {
+            double sent = _link_rate / std::max(_ratio, 0.01);
+            if (_deflate_rate > 4 * sent && _level < 6) {
+                _level++;
+                _deflate_rate = 0; // measure again with the new level
+            } else if (_deflate_rate < sent && _level > 1) {
+                _level--;
+                _deflate_rate = 0;
+            }
+        }
+    }
+
+    // the bytes have been sent in seconds, the send is blocking.
+    void onSent(size_t bytes, double seconds)
+    {
+        if (bytes >= BLOCK_SIZE && seconds > 0)
+            _link_rate = average(_link_rate, bytes / seconds);
+    }
+
+private:
+    static double average(double old, double now)
+    {
+        return old <= 0 ? now : old * 0.7 + now * 0.3;
+    }
+
+    std::string _path;
+    double _ratio { 0 };  // the compressed ratio of current file
+    double _deflate_rate { 0 }; // bytes per second
+    double _link_rate { 0 }; // bytes per second
+    int _skipped { 0 };
+    int _level { 1 };
+};
+
+#endif // WEBCOMPRESS_H
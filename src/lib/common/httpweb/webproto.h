@@ -51,4 +51,73 @@ struct InfoEntry {
     }
 };
 
+// one entry of the recursive manifest, one json object per line.
+struct ManifestEntry {
+    std::string name; // the path relative to the requested dir
+    int64_t size {0};  // file size, dir size set as -1
+    int64_t mtime {0}; // the file modified time in ns, 0 if unknown
+
+    void from_json(const picojson::value &obj)
+    {
+        name = obj.get("name").to_str();
+        size = obj.get("size").get<int64_t>();
+        if (obj.get("mtime").is<int64_t>())
+            mtime = obj.get("mtime").get<int64_t>();
+    }
+
+    picojson::value as_json() const
+    {
+        picojson::object obj;
+        obj["name"] = picojson::value(name);
+        obj["size"] = picojson::value(size);
+        if (mtime > 0)
+            obj["mtime"] = picojson::value(mtime);
+        return picojson::value(obj);
+    }
+};
+
+// the record header of packed small file, followed by the name and data.
+// all fields are little endian: name_len(4) mode(4) mtime(8) size(8)
+#define PACK_HEADER_SIZE 24
+
+struct PackHeader {
+    uint32_t name_len {0}; // the web name length
+    uint32_t mode {0};  // the permissions
+    uint64_t mtime {0}; // the modified time in nanoseconds
+    uint64_t size {0};  // the data size
+
+    void encode(char *buf) const
+    {
+        putValue(buf, name_len, 4);
+        putValue(buf + 4, mode, 4);
+        putValue(buf + 8, mtime, 8);
+        putValue(buf + 16, size, 8);
+    }
+
+    void decode(const char *buf)
+    {
+        name_len = static_cast<uint32_t>(getValue(buf, 4));
+        mode = static_cast<uint32_t>(getValue(buf + 4, 4));
+        mtime = getValue(buf + 8, 8);
+        size = getValue(buf + 16, 8);
+    }
+
+private:
+    static void putValue(char *buf, uint64_t value, int bytes)
+    {
+        for (int i = 0; i < bytes; ++i) {
+            buf[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+    }
+
+    static uint64_t getValue(const char *buf, int bytes)
+    {
+        uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(buf[i])) << (8 * i);
+        }
+        return value;
+    }
+};
+
 #endif // WEBPROTO_H
@@ -0,0 +1,282 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dirsizeservice.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+#include <algorithm>
+
+#ifdef Q_OS_UNIX
+#include <sys/stat.h>
+#endif
+
+// the names kept at most in the cached listings, about 100 bytes each
+#define MAX_CACHE_NAMES 500000
+#define PROGRESS_INTERVAL 200
+
+// the index of the worker running in this thread, -1 for the others
+static thread_local int t_worker = -1;
+
+// the size of a file, the symlink of a file counts its target
+static quint64 fileSize(const QString &path)
+{
+#ifdef Q_OS_UNIX
+    struct stat st;
+    if (::stat(QFile::encodeName(path).constData(), &st) != 0)
+        return 0;
+    return static_cast<quint64>(st.st_size);
+#else
+    QFileInfo info(path);
+    return info.exists() ? static_cast<quint64>(info.size()) : 0;
+#endif
+}
+
+struct DirSizeService::Request {
+    QString path;
+    std::atomic<quint64> total { 0 };
+    std::atomic_int pending { 1 }; // the dirs waiting or being listed
+    std::atomic_bool canceled { false };
+    std::atomic<qint64> reported { 0 };
+};
+
+DirSizeService *DirSizeService::instance()
+{
+    static DirSizeService ins;
+    return &ins;
+}
+
+DirSizeService::DirSizeService(QObject *parent)
+    : QObject(parent)
+{
+}
+
+DirSizeService::~DirSizeService()
+{
+    cancelAll();
+    _stoped = true;
+    {
+        std::lock_guard<std::mutex> g(_idle_lock);
+    }
+    _idle.notify_all();
+    for (auto &worker : _workers) {
+        if (worker.joinable())
+            worker.join();
+    }
+}
+
+void DirSizeService::calculate(const QString &path)
+{
+    QFileInfo info(path);
+    if (!info.isDir()) {
+        emit sizeFinished(path, info.exists() ? static_cast<quint64>(info.size()) : 0);
+        return;
+    }
+
+    auto req = std::make_shared<Request>();
+    req->path = path;
+    {
+        std::lock_guard<std::mutex> g(_lock);
+        if (_requests.contains(path))
+            return;
+        _requests.insert(path, req);
+    }
+    startWorkers();
+    post({ req, path });
+}
+
+void DirSizeService::cancel(const QString &path)
+{
+    std::lock_guard<std::mutex> g(_lock);
+    auto req = _requests.take(path);
+    if (req)
+        req->canceled = true;
+}
+
+void DirSizeService::cancelAll()
+{
+    std::lock_guard<std::mutex> g(_lock);
+    for (auto &req : _requests)
+        req->canceled = true;
+    _requests.clear();
+}
+
+void DirSizeService::startWorkers()
+{
+    std::lock_guard<std::mutex> g(_lock);
+    if (!_workers.empty())
+        return;
+
+    int count = std::max(2, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int i = 0; i < count; ++i)
+        _queues.emplace_back(new TaskQueue);
+    for (int i = 0; i < count; ++i)
+        _workers.emplace_back(&DirSizeService::workLoop, this, i);
+}
+
+void DirSizeService::post(Task task)
+{
+    // the subdirs stay in the queue of the worker which found them
+    int index = t_worker >= 0 ? t_worker : static_cast<int>(_next++ % _queues.size());
+    {
+        std::lock_guard<std::mutex> g(_queues[index]->lock);
+        _queues[index]->tasks.push_back(std::move(task));
+        _queued++;
+    }
+    {
+        std::lock_guard<std::mutex> g(_idle_lock);
+    }
+    _idle.notify_one();
+}
+
+bool DirSizeService::take(int self, Task *task)
+{
+    // the newest of its own first, it is the deepest dir and keeps the queue short
+    {
+        TaskQueue *queue = _queues[self].get();
+        std::lock_guard<std::mutex> g(queue->lock);
+        if (!queue->tasks.empty()) {
+            *task = std::move(queue->tasks.back());
+            queue->tasks.pop_back();
+            return true;
+        }
+    }
+    // steal the oldest of the others, it is the biggest subtree
+    int count = static_cast<int>(_queues.size());
+    for (int i = 1; i < count; ++i) {
+        TaskQueue *queue = _queues[(self + i) % count].get();
+        std::lock_guard<std::mutex> g(queue->lock);
+        if (!queue->tasks.empty()) {
+            *task = std::move(queue->tasks.front());
+            queue->tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void DirSizeService::workLoop(int self)
+{
+    t_worker = self;
+    while (!_stoped) {
+        Task task;
+        if (take(self, &task)) {
+            _queued--;
+            runTask(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lk(_idle_lock);
+        _idle.wait_for(lk, std::chrono::milliseconds(100), [this] {
+            return _stoped || _queued > 0;
+        });
+    }
+}
+
+void DirSizeService::runTask(const Task &task)
+{
+    const auto &req = task.req;
+    DirEntry entry;
+    quint64 size = 0;
+    if (!req->canceled && !_stoped && listDir(task.path, &entry, &size)) {
+        req->total += size;
+        for (const QString &dir : entry.dirs) {
+            req->pending++;
+            post({ req, dir });
+        }
+    }
+    finishDir(req);
+}
+
+void DirSizeService::finishDir(const std::shared_ptr<Request> &req)
+{
+    if (--req->pending > 0) {
+        qint64 now = QDateTime::currentMSecsSinceEpoch();
+        qint64 last = req->reported;
+        if (!req->canceled && now - last >= PROGRESS_INTERVAL && req->reported.compare_exchange_strong(last, now))
+            emit sizeProgress(req->path, req->total);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> g(_lock);
+        auto it = _requests.find(req->path);
+        if (it != _requests.end() && it.value() == req)
+            _requests.erase(it);
+    }
+    if (!req->canceled)
+        emit sizeFinished(req->path, req->total);
+}
+
+bool DirSizeService::listDir(const QString &path, DirEntry *entry, quint64 *size)
+{
+    quint64 id = 0;
+    qint64 mtime = 0;
+#ifdef Q_OS_UNIX
+    struct stat st;
+    if (::stat(QFile::encodeName(path).constData(), &st) != 0)
+        return false;
+    id = static_cast<quint64>(st.st_ino);
+#ifdef Q_OS_LINUX
+    mtime = static_cast<qint64>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+#else
+    mtime = static_cast<qint64>(st.st_mtime);
+#endif
+#else
+    QFileInfo info(path);
+    if (!info.exists())
+        return false;
+    mtime = info.lastModified().toMSecsSinceEpoch();
+#endif
+
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> g(_lock);
+        auto it = _cache.constFind(path);
+        if (it != _cache.constEnd() && it->id == id && it->mtime == mtime) {
+            *entry = it.value();
+            cached = true;
+        }
+    }
+    if (cached) {
+        // the files may be changed in place
+        for (const QString &file : entry->files)
+            *size += fileSize(file);
+        return true;
+    }
+
+    entry->id = id;
+    entry->mtime = mtime;
+    QDir dir(path);
+    QFileInfoList infoList = dir.entryInfoList(QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot | QDir::Hidden | QDir::System);
+    for (const QFileInfo &info : infoList) {
+        if (info.isSymLink()) {
+            // 链接到文件的统计目标大小，链接到目录的跳过，避免循环
+            if (info.exists() && !info.isDir()) {
+                entry->files.append(info.filePath());
+                *size += static_cast<quint64>(info.size());
+            }
+        } else if (info.isDir()) {
+            entry->dirs.append(info.filePath());
+        } else {
+            entry->files.append(info.filePath());
+            *size += static_cast<quint64>(info.size());
+        }
+    }
+
+    int names = entry->files.size() + entry->dirs.size();
+    std::lock_guard<std::mutex> g(_lock);
+    auto old = _cache.constFind(path);
+    if (old != _cache.constEnd())
+        _cached_names -= old->files.size() + old->dirs.size();
+    if (_cached_names + names > MAX_CACHE_NAMES) {
+        _cache.clear();
+        _cached_names = 0;
+    }
+    _cache.insert(path, *entry);
+    _cached_names += names;
+    return true;
+}
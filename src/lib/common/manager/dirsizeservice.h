@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef DIRSIZESERVICE_H
+#define DIRSIZESERVICE_H
+
+#include <QObject>
+#include <QHash>
+#include <QStringList>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The size calculation shared by the apps. Every dir is a task of a work-stealing pool: a worker
+// pushes the subdirs into its own queue and takes from its back, the idle workers steal from the
+// front of the others. The listing of a dir is cached by its identity (inode) and mtime, so sizing
+// the same dirs again skips reading them. The files are stat each time, a file changed in place
+// does not touch the mtime of its dir.
+// Hidden and system files are counted, the symlink of a file counts its target, the symlink of a
+// dir is skipped to avoid cycles.
+class DirSizeService : public QObject
+{
+    Q_OBJECT
+public:
+    static DirSizeService *instance();
+    ~DirSizeService() override;
+
+    // size the path in background, the same path being sized is not restarted.
+    void calculate(const QString &path);
+    void cancel(const QString &path);
+    void cancelAll();
+
+signals:
+    // the partial total while walking, at most every 200ms for a path
+    void sizeProgress(const QString path, quint64 partialSize);
+    void sizeFinished(const QString path, quint64 totalSize);
+
+private:
+    explicit DirSizeService(QObject *parent = nullptr);
+
+    struct Request;
+    struct Task {
+        std::shared_ptr<Request> req;
+        QString path;
+    };
+    struct TaskQueue {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+    struct DirEntry {
+        quint64 id { 0 };
+        qint64 mtime { 0 };
+        QStringList files; // the files directly in the dir, sized each time
+        QStringList dirs;
+    };
+
+    void startWorkers();
+    void post(Task task);
+    bool take(int self, Task *task);
+    void workLoop(int self);
+    void runTask(const Task &task);
+    void finishDir(const std::shared_ptr<Request> &req);
+    // list the dir or take its cached listing, and size the files in it now
+    bool listDir(const QString &path, DirEntry *entry, quint64 *size);
+
+    std::vector<std::unique_ptr<TaskQueue>> _queues;
+    std::vector<std::thread> _workers;
+    std::atomic_int _queued { 0 };
+    std::atomic_uint _next { 0 };
+    std::atomic_bool _stoped { false };
+    std::mutex _idle_lock;
+    std::condition_variable _idle;
+
+    std::mutex _lock; // guard the requests and the cache
+    QHash<QString, std::shared_ptr<Request>> _requests;
+    QHash<QString, DirEntry> _cache;
+    int _cached_names { 0 };
+};
+
+#endif // DIRSIZESERVICE_H
@@ -3,72 +3,52 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "filesizecounter.h"
+#include "dirsizeservice.h"
 
-#include <QDir>
 #include <QFileInfo>
 
 FileSizeCounter::FileSizeCounter(QObject *parent)
-    : QThread{parent}
+    : QObject{parent}
 {
-
+    connect(DirSizeService::instance(), &DirSizeService::sizeFinished, this, &FileSizeCounter::handleSizeFinished, Qt::QueuedConnection);
 }
 
 quint64 FileSizeCounter::countFiles(const QString &targetIp, const QStringList paths)
 {
+    // 新的统计替换未完成的旧统计，旧结果到达时忽略（其他模块可能也在等待同一目录，不取消）
+    _waiting.clear();
     _targetIp = "";
     _paths.clear();
 
     quint64 totalSize = 0;
+    QStringList dirs;
     foreach (const QString &path, paths) {
         QFileInfo fileInfo(path);
         if (fileInfo.isDir()) {
-            _paths = paths;
-            _targetIp = targetIp;
-            start();
-            return 0;
+            dirs.append(path);
         } else {
             totalSize += fileInfo.size();
         }
     }
-
-    return totalSize;
+    if (dirs.isEmpty())
+        return totalSize;
+
+    _paths = paths;
+    _targetIp = targetIp;
+    _totalSize = totalSize;
+    for (const QString &dir : dirs)
+        _waiting.insert(dir);
+    for (const QString &dir : dirs)
+        DirSizeService::instance()->calculate(dir);
+    return 0;
 }
 
-
-void FileSizeCounter::run()
+void FileSizeCounter::handleSizeFinished(const QString path, quint64 totalSize)
 {
-    _totalSize = 0;
-    foreach (const QString &path, _paths) {
-        countFilesInDir(path);
-    }
-    emit onCountFinish(_targetIp, _paths, _totalSize);
-}
-
-void FileSizeCounter::countFilesInDir(const QString &path)
-{
-    QFileInfo fileInfo(path);
-    if (fileInfo.isFile()) {
-        _totalSize += fileInfo.size();
+    if (!_waiting.remove(path))
         return;
-    }
 
-    QDir dir(path);
-    QFileInfoList infoList = dir.entryInfoList(QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot | QDir::Hidden | QDir::System);
-    foreach (const QFileInfo &info, infoList) {
-        if (info.isSymLink()) {
-            // 处理符号链接
-            QFileInfo targetInfo(info.symLinkTarget());
-            if (targetInfo.exists()) {
-                if (targetInfo.isDir()) {
-                    countFilesInDir(targetInfo.filePath());
-                } else {
-                    _totalSize += targetInfo.size();
-                }
-            }
-        } else if (info.isDir()) {
-            countFilesInDir(info.filePath()); // 递归遍历子目录
-        } else {
-            _totalSize += info.size(); // 统计文件大小
-        }
-    }
+    _totalSize += totalSize;
+    if (_waiting.isEmpty())
+        emit onCountFinish(_targetIp, _paths, _totalSize);
 }
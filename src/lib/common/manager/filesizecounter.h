@@ -5,27 +5,29 @@
 #ifndef FILESIZECOUNTER_H
 #define FILESIZECOUNTER_H
 
-#include <QThread>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
 
-class FileSizeCounter : public QThread
+class FileSizeCounter : public QObject
 {
     Q_OBJECT
 public:
     explicit FileSizeCounter(QObject *parent = nullptr);
 
+    // return the total size if all are files, otherwise 0 and the dirs are sized by DirSizeService.
     quint64 countFiles(const QString &targetIp, const QStringList paths);
 
 signals:
     void onCountFinish(const QString targetIp, const QStringList paths, quint64 totalSize);
 
-protected:
-    void run() override;
+private slots:
+    void handleSizeFinished(const QString path, quint64 totalSize);
 
 private:
-    void countFilesInDir(const QString &path);
-
     QStringList _paths;
     QString _targetIp;
+    QSet<QString> _waiting; // the dirs not sized yet
     quint64 _totalSize {0};
 };
 
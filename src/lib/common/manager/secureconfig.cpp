@@ -5,12 +5,33 @@
 #include "secureconfig.h"
 
 #include "configs/crypt/cert.h"
+#include "session/sslsessioncache.h"
+
+// the resumable sessions of the servers
+static const unsigned char SESSION_ID_CONTEXT[] = "dde-cooperation";
+// in seconds
+#define SESSION_TIMEOUT 7200
 
 // SecureConfig::SecureConfig() {
 // }
 
 
 std::shared_ptr<CppServer::Asio::SSLContext> SecureConfig::serverContext()
+{
+    // one context for all the servers: the ticket key and the session cache are kept in it,
+    // the remote can resume its session on any of them
+    static std::shared_ptr<CppServer::Asio::SSLContext> context = createServerContext();
+    return context;
+}
+
+
+std::shared_ptr<CppServer::Asio::SSLContext> SecureConfig::clientContext()
+{
+    static std::shared_ptr<CppServer::Asio::SSLContext> context = createClientContext();
+    return context;
+}
+
+std::shared_ptr<CppServer::Asio::SSLContext> SecureConfig::createServerContext()
 {
     auto rsa_crt = Cert::instance()->getRSACrt();
     auto rsa_key = Cert::instance()->getRSAKey();
@@ -22,11 +43,16 @@ std::shared_ptr<CppServer::Asio::SSLContext> SecureConfig::serverContext()
     context->use_certificate(cert_buf, asio::ssl::context::pem);
     context->use_rsa_private_key(key_buf, asio::ssl::context::pem);
 
+    // issue the session tickets, the reconnection skips the full handshake
+    SSL_CTX *ctx = context->native_handle();
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+    SSL_CTX_set_session_id_context(ctx, SESSION_ID_CONTEXT, sizeof(SESSION_ID_CONTEXT) - 1);
+    SSL_CTX_set_timeout(ctx, SESSION_TIMEOUT);
+
     return context;
 }
 
-
-std::shared_ptr<CppServer::Asio::SSLContext> SecureConfig::clientContext()
+std::shared_ptr<CppServer::Asio::SSLContext> SecureConfig::createClientContext()
 {
     auto rsa_crt = Cert::instance()->getRSACrt();
     asio::const_buffer cert_buf(rsa_crt.data(), rsa_crt.size());
@@ -36,5 +62,8 @@ std::shared_ptr<CppServer::Asio::SSLContext> SecureConfig::clientContext()
     // context->set_verify_mode(asio::ssl::verify_peer | asio::ssl::verify_fail_if_no_peer_cert);
     context->use_certificate(cert_buf, asio::ssl::context::pem);
 
+    // keep the tickets from the remotes, the clients resume them by SSLSessionCache
+    SSLSessionCache::enable(context->native_handle());
+
     return context;
 }
@@ -14,6 +14,8 @@ public:
     static std::shared_ptr<CppServer::Asio::SSLContext> clientContext();
 
 private:
+    static std::shared_ptr<CppServer::Asio::SSLContext> createServerContext();
+    static std::shared_ptr<CppServer::Asio::SSLContext> createClientContext();
 };
 
 #endif // SECURECONFIG_H
@@ -28,6 +28,12 @@ SessionManager::SessionManager(QObject *parent) : QObject(parent)
 
     _file_counter = std::make_shared<FileSizeCounter>(this);
     connect(_file_counter.get(), &FileSizeCounter::onCountFinish, this, &SessionManager::handleFileCounted);
+
+    // 退出前停止共享的io线程，避免其在静态析构时仍在运行
+    if (qApp)
+        connect(qApp, &QCoreApplication::aboutToQuit, this, []() {
+            AsioService::stopShared();
+        });
 }
 
 SessionManager::~SessionManager()
@@ -42,6 +48,11 @@ void SessionManager::setSessionExtCallback(ExtenMessageHandler cb)
     _session_worker->setExtMessageHandler(cb);
 }
 
+void SessionManager::setSessionApplyCallback(ExtenApplyHandler cb)
+{
+    _session_worker->setExtApplyHandler(cb);
+}
+
 void SessionManager::updatePin(QString code)
 {
     _session_worker->updatePincode(code);
@@ -68,6 +79,11 @@ void SessionManager::updateLoginStatus(QString &ip, bool logined)
     _session_worker->updateLogin(ip, logined);
 }
 
+void SessionManager::setIncrementalSync(bool incremental)
+{
+    _incremental = incremental;
+}
+
 void SessionManager::sessionListen(int port)
 {
     bool success = _session_worker->startListen(port);
@@ -102,8 +118,7 @@ int SessionManager::sessionConnect(QString ip, int port, QString password)
     req.name = deepin_cross::CommonUitls::getFirstIp();
     req.auth = pinString;
 
-    QString jsonMsg = req.as_json().serialize().c_str();
-    sendRpcRequest(ip, REQ_LOGIN, jsonMsg);
+    sendRpcRequest(ip, REQ_LOGIN, req);
 
     return 0;
 }
@@ -121,6 +136,7 @@ std::shared_ptr<TransferWorker> SessionManager::createTransWorker(const QString
     // auto newWorker = QSharedPointer<TransferWorker>::create(this);
     connect(newWorker.get(), &TransferWorker::notifyChanged, this, &SessionManager::notifyTransChanged);
     connect(newWorker.get(), &TransferWorker::onException, this, &SessionManager::handleTransException);
+    newWorker->setIncremental(_incremental);
 
     // Store it in the map with the given jobid
     _trans_workers[jobid] = newWorker;
@@ -153,8 +169,7 @@ void SessionManager::sendFiles(QString &ip, int port, QStringList paths)
     req.flag = needCount; // many folders
     req.size = total; // unkown size
 
-    QString jsonMsg = req.as_json().serialize().c_str();
-    sendRpcRequest(ip, REQ_TRANS_DATAS, jsonMsg);
+    sendRpcRequest(ip, REQ_TRANS_DATAS, req);
 
     if (total > 0) {
         QString oneName = paths.join(";");
@@ -181,8 +196,7 @@ void SessionManager::cancelSyncFile(const QString &ip, const QString &reason)
     req.name = "all";
     req.reason = reason.toStdString();
 
-    QString jsonMsg = req.as_json().serialize().c_str();
-    sendRpcRequest(ip, REQ_TRANS_CANCLE, jsonMsg);
+    sendRpcRequest(ip, REQ_TRANS_CANCLE, req);
 
     // then: stop local worker
     handleCancelTrans(ip, reason);
@@ -199,6 +213,26 @@ void SessionManager::sendRpcRequest(const QString &ip, int type, const QString &
     _session_worker->sendAsyncRequest(ip, request);
 }
 
+void SessionManager::sendRpcRequest(const QString &target, int type, const LoginMessage &req)
+{
+    _session_worker->sendAsyncRequest(target, type, req);
+}
+
+void SessionManager::sendRpcRequest(const QString &target, int type, const ApplyMessage &req)
+{
+    _session_worker->sendAsyncRequest(target, type, req);
+}
+
+void SessionManager::sendRpcRequest(const QString &target, int type, const TransDataMessage &req)
+{
+    _session_worker->sendAsyncRequest(target, type, req);
+}
+
+void SessionManager::sendRpcRequest(const QString &target, int type, const TransCancelMessage &req)
+{
+    _session_worker->sendAsyncRequest(target, type, req);
+}
+
 void SessionManager::handleTransData(const QString endpoint, const QStringList nameVector)
 {
     QStringList parts = endpoint.split(":");
@@ -256,8 +290,7 @@ void SessionManager::handleFileCounted(const QString ip, const QStringList paths
     req.flag = false; // no need count
     req.size = totalSize;
 
-    QString jsonMsg = req.as_json().serialize().c_str();
-    sendRpcRequest(ip, INFO_TRANS_COUNT, jsonMsg);
+    sendRpcRequest(ip, INFO_TRANS_COUNT, req);
 
     // notify local
     QString oneName = paths.join(";");
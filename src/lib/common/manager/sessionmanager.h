@@ -21,10 +21,13 @@ public:
     ~SessionManager();
 
     void setSessionExtCallback(ExtenMessageHandler cb);
+    void setSessionApplyCallback(ExtenApplyHandler cb);
     void updatePin(QString code);
     void setStorageRoot(const QString &root);
     void updateSaveFolder(const QString &folder);
     void updateLoginStatus(QString &ip, bool logined);
+    // incremental sync: the receiving skips the same files and patches the changed ones
+    void setIncrementalSync(bool incremental);
 
     void sessionListen(int port);
     bool sessionPing(QString ip, int port);
@@ -35,6 +38,11 @@ public:
     void cancelSyncFile(const QString &ip, const QString &reason = "");
 
     void sendRpcRequest(const QString &target, int type, const QString &reqJson);
+    // sent as the typed messages to the remotes support them
+    void sendRpcRequest(const QString &target, int type, const LoginMessage &req);
+    void sendRpcRequest(const QString &target, int type, const ApplyMessage &req);
+    void sendRpcRequest(const QString &target, int type, const TransDataMessage &req);
+    void sendRpcRequest(const QString &target, int type, const TransCancelMessage &req);
 
 signals:
     void notifyCancelWeb();
@@ -67,6 +75,7 @@ private:
 
     QString _save_root = "";
     QString _save_dir = "";
+    bool _incremental { false };
 };
 
 #endif // SESSIONMANAGER_H
@@ -51,6 +51,10 @@ typedef enum apply_flag_t {
 
 using ExtenMessageHandler = std::function<bool(int32_t mask, const picojson::value &json_value, std::string *res_msg)>;
 
+struct ApplyMessage;
+// the apply messages, received as the typed message or parsed from the json of the old remotes
+using ExtenApplyHandler = std::function<bool(int32_t mask, const ApplyMessage &req, ApplyMessage *res)>;
+
 struct LoginMessage {
     std::string name;
     std::string auth;
@@ -153,10 +157,13 @@ struct ApplyMessage {
     std::string  fingerprint {""};
 
     void from_json(const picojson::value& _x_) {
-        flag = _x_.get("flag").get<int64_t>();
+        // it is tried for the unknown types, do not assert the missing fields
+        if (_x_.get("flag").is<double>())
+            flag = _x_.get("flag").get<int64_t>();
         nick = _x_.get("nick").to_str();
         host = _x_.get("selfIp").to_str();
-        port = _x_.get("selfPort").get<int64_t>();
+        if (_x_.get("selfPort").is<double>())
+            port = _x_.get("selfPort").get<int64_t>();
         if (_x_.contains("fingerprint"))
             fingerprint = _x_.get("fingerprint").to_str();
         else
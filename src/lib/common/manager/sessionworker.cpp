@@ -14,16 +14,93 @@
 #include <QCoreApplication>
 #include <QStorageInfo>
 
+// the typed messages carry the same fields as the json messages
+static void toData(const LoginMessage &msg, proto::LoginData *data)
+{
+    data->name = msg.name;
+    data->auth = msg.auth;
+}
+
+static void fromData(const proto::LoginData &data, LoginMessage *msg)
+{
+    msg->name = data.name;
+    msg->auth = data.auth;
+}
+
+static void toData(const ApplyMessage &msg, proto::ApplyData *data)
+{
+    data->flag = msg.flag;
+    data->nick = msg.nick;
+    data->host = msg.host;
+    data->port = msg.port;
+    data->fingerprint = msg.fingerprint;
+}
+
+static void fromData(const proto::ApplyData &data, ApplyMessage *msg)
+{
+    msg->flag = data.flag;
+    msg->nick = data.nick;
+    msg->host = data.host;
+    msg->port = data.port;
+    msg->fingerprint = data.fingerprint;
+}
+
+static void toData(const TransDataMessage &msg, proto::TransData *data)
+{
+    data->job = msg.id;
+    data->names = msg.names;
+    data->endpoint = msg.endpoint;
+    data->flag = msg.flag;
+    data->size = msg.size;
+}
+
+static void fromData(const proto::TransData &data, TransDataMessage *msg)
+{
+    msg->id = data.job;
+    msg->names = data.names;
+    msg->endpoint = data.endpoint;
+    msg->flag = data.flag;
+    msg->size = data.size;
+}
+
+static void toData(const TransCancelMessage &msg, proto::CancelData *data)
+{
+    data->job = msg.id;
+    data->name = msg.name;
+    data->reason = msg.reason;
+}
+
+static void fromData(const proto::CancelData &data, TransCancelMessage *msg)
+{
+    msg->id = data.job;
+    msg->name = data.name;
+    msg->reason = data.reason;
+}
+
+// handle the json message of the old remotes by the typed handler, reply the json
+template<typename T, typename M>
+static bool handleJson(SessionWorker *worker, int32_t mask, const picojson::value &v, std::string *res_json)
+{
+    M req, res;
+    req.from_json(v);
+
+    T request, response;
+    request.mask = mask;
+    toData(req, &request);
+    response.mask = mask;
+    if (!worker->onReceivedMessage(request, &response))
+        return false;
+
+    fromData(response, &res);
+    *res_json = res.as_json().serialize();
+    return true;
+}
+
 SessionWorker::SessionWorker(QObject *parent)
     : QObject(parent)
 {
-    // create own asio service
-    _asioService = std::make_shared<AsioService>();
-    if (!_asioService) {
-        ELOG << "carete ASIO for session worker ERROR!";
-        return;
-    }
-    _asioService->Start();
+    // the sessions run on the shared asio service
+    _asioService = AsioService::shared();
 
     QObject::connect(this, &SessionWorker::onRemoteDisconnected, this, &SessionWorker::handleRemoteDisconnected, Qt::QueuedConnection);
     QObject::connect(this, &SessionWorker::onRejectConnection, this, &SessionWorker::handleRejectConnection, Qt::QueuedConnection);
@@ -31,7 +108,7 @@ SessionWorker::SessionWorker(QObject *parent)
 
 SessionWorker::~SessionWorker()
 {
-    _asioService->Stop();
+    // the shared asio service is kept for the other workers
 }
 
 void SessionWorker::onReceivedMessage(const proto::OriginMessage &request, proto::OriginMessage *response)
@@ -67,30 +144,9 @@ void SessionWorker::onReceivedMessage(const proto::OriginMessage &request, proto
 
     int type = request.mask;
     switch (type) {
-    case REQ_LOGIN: {
-        LoginMessage req, res;
-        req.from_json(v);
-        DLOG << "Login: " << req.name << " " << req.auth;
-
-        QString nice = QString::fromStdString(req.name);
-        QByteArray pinByte = QByteArray::fromStdString(req.auth);
-        QString dePin = QString::fromUtf8(QByteArray::fromBase64(pinByte));
-        if (dePin == _savedPin) {
-            res.auth = "thatsgood";
-            emit onConnectChanged(LOGIN_SUCCESS, nice);
-        } else {
-            // return empty auth token.
-            res.auth = "";
-            emit onConnectChanged(LOGIN_DENIED, nice);
-
-            emit onRejectConnection();
-        }
-
-        res.name = deepin_cross::CommonUitls::getFirstIp();
-        response->json_msg = res.as_json().serialize();
-        return;
-    }
-    break;
+    case REQ_LOGIN:
+        handleJson<proto::LoginData, LoginMessage>(this, type, v, &response->json_msg);
+        break;
     case REQ_FREE_SPACE: {
         FreeSpaceMessage req, res;
         req.from_json(v);
@@ -100,77 +156,130 @@ void SessionWorker::onReceivedMessage(const proto::OriginMessage &request, proto
         response->json_msg = res.as_json().serialize();
     }
     break;
-    case REQ_TRANS_DATAS: {
-        TransDataMessage req, res;
-        req.from_json(v);
+    case REQ_TRANS_DATAS:
+    case INFO_TRANS_COUNT:
+        handleJson<proto::TransData, TransDataMessage>(this, type, v, &response->json_msg);
+        break;
+    case REQ_TRANS_CANCLE:
+        handleJson<proto::CancelData, TransCancelMessage>(this, type, v, &response->json_msg);
+        break;
+    case CAST_INFO: {
+    }
+    break;
+    default:
+        // the apply messages from the remotes without the typed messages
+        if (_extApplyhandler && handleJson<proto::ApplyData, ApplyMessage>(this, type, v, &response->json_msg))
+            return;
+        DLOG << "unkown type: " << type;
+        break;
+    }
+}
 
-        QString endpoint = QString::fromStdString(req.endpoint);
-        QStringList nameList;
-        for (auto name : req.names) {
-            nameList.append(QString::fromStdString(name));
-        }
+bool SessionWorker::onReceivedMessage(const proto::LoginData &request, proto::LoginData *response)
+{
+    if (request.mask != REQ_LOGIN) {
+        DLOG << "unkown login type: " << request.mask;
+        return false;
+    }
 
-        res.id = req.id;
-        res.names = req.names;
-        res.flag = true;
-        res.size = 0;//TransferHelper::getRemainSize();
-        response->json_msg = res.as_json().serialize();
+    response->mask = DO_SUCCESS;
+    DLOG << "Login: " << request.name << " " << request.auth;
+
+    QString nice = QString::fromStdString(request.name);
+    QByteArray pinByte = QByteArray::fromStdString(request.auth);
+    QString dePin = QString::fromUtf8(QByteArray::fromBase64(pinByte));
+    if (dePin == _savedPin) {
+        response->auth = "thatsgood";
+        emit onConnectChanged(LOGIN_SUCCESS, nice);
+    } else {
+        // return empty auth token.
+        response->auth = "";
+        emit onConnectChanged(LOGIN_DENIED, nice);
+
+        emit onRejectConnection();
+    }
+
+    response->name = deepin_cross::CommonUitls::getFirstIp();
+    return true;
+}
+
+bool SessionWorker::onReceivedMessage(const proto::ApplyData &request, proto::ApplyData *response)
+{
+    if (!_extApplyhandler)
+        return false;
+
+    ApplyMessage req, res;
+    fromData(request, &req);
+    if (!_extApplyhandler(request.mask, req, &res))
+        return false;
+
+    response->mask = DO_SUCCESS;
+    toData(res, response);
+    return true;
+}
+
+bool SessionWorker::onReceivedMessage(const proto::TransData &request, proto::TransData *response)
+{
+    QStringList nameList;
+    for (auto name : request.names) {
+        nameList.append(QString::fromStdString(name));
+    }
+    uint64_t total = request.size;
+
+    switch (request.mask) {
+    case REQ_TRANS_DATAS: {
+        QString endpoint = QString::fromStdString(request.endpoint);
+
+        response->job = request.job;
+        response->names = request.names;
+        response->flag = true;
+        response->size = 0;//TransferHelper::getRemainSize();
 
         emit onTransData(endpoint, nameList);
 
-        uint64_t total = req.size;
         if (total > 0) {
             QString oneName = nameList.join(";");
             emit onTransCount(oneName, total);
         }
-        return;
-    }
-    break;
-    case REQ_TRANS_CANCLE: {
-        TransCancelMessage req, res;
-        req.from_json(v);
-
-        DLOG << "recv cancel id: " << req.id << " " << req.reason;
-
-        res.id = req.id;
-        res.name = req.name;
-        res.reason = "";
-        response->json_msg = res.as_json().serialize();
-
-        QString jobid = QString::fromStdString(req.id);
-        QString reason = QString::fromStdString(req.reason);
-        emit onCancelJob(jobid, reason);
-        return;
-    }
-    break;
-    case CAST_INFO: {
     }
     break;
     case INFO_TRANS_COUNT: {
-        TransDataMessage req, res;
-        req.from_json(v);
+        response->job = request.job;
+        response->names = request.names;
+        response->flag = request.flag;
+        response->size = total;
 
-        QStringList nameList;
-        for (auto name : req.names) {
-            nameList.append(QString::fromStdString(name));
-        }
         QString oneName = nameList.join(";");
-        uint64_t total = req.size;
-
-        res.id = req.id;
-        res.names = req.names;
-        res.flag = req.flag;
-        res.size = total;
-        response->json_msg = res.as_json().serialize();
-
         emit onTransCount(oneName, total);
-        return;
     }
     break;
     default:
-        DLOG << "unkown type: " << type;
-        break;
+        DLOG << "unkown trans type: " << request.mask;
+        return false;
     }
+
+    response->mask = DO_SUCCESS;
+    return true;
+}
+
+bool SessionWorker::onReceivedMessage(const proto::CancelData &request, proto::CancelData *response)
+{
+    if (request.mask != REQ_TRANS_CANCLE) {
+        DLOG << "unkown cancel type: " << request.mask;
+        return false;
+    }
+
+    DLOG << "recv cancel id: " << request.job << " " << request.reason;
+
+    response->mask = DO_SUCCESS;
+    response->job = request.job;
+    response->name = request.name;
+    response->reason = "";
+
+    QString jobid = QString::fromStdString(request.job);
+    QString reason = QString::fromStdString(request.reason);
+    emit onCancelJob(jobid, reason);
+    return true;
 }
 
 bool SessionWorker::onStateChanged(int state, std::string &msg)
@@ -196,6 +305,10 @@ bool SessionWorker::onStateChanged(int state, std::string &msg)
         if (addr.isEmpty()) {
             DLOG << "disconnect with NULL, retry? " << _tryConnect;
             return _tryConnect;
+        } else if (dropWarmClient(addr)) {
+            // not the current remote, do not retry
+            DLOG << "warm remote disconnected: " << msg;
+            return false;
         } else {
             DLOG << "disconnected remote: " << msg;
             emit onRemoteDisconnected(addr);
@@ -215,6 +328,10 @@ bool SessionWorker::onStateChanged(int state, std::string &msg)
     }
     break;
     case RPC_PINGOUT: {
+        if (closeWarmClient(addr)) {
+            DLOG << "warm remote timeout: " << msg;
+            return false;
+        }
         // receive pong timeout
         DLOG << "timeout remote: " << msg;
         emit onRemoteDisconnected(addr);
@@ -235,6 +352,11 @@ void SessionWorker::setExtMessageHandler(ExtenMessageHandler cb)
     _extMsghandler = std::move(cb);
 }
 
+void SessionWorker::setExtApplyHandler(ExtenApplyHandler cb)
+{
+    _extApplyhandler = std::move(cb);
+}
+
 void SessionWorker::stop()
 {
     if (_server) {
@@ -245,6 +367,7 @@ void SessionWorker::stop()
     if (_client) {
         _client->DisconnectAndStop();
     }
+    clearWarmClients();
 }
 
 bool SessionWorker::startListen(int port)
@@ -274,6 +397,7 @@ void SessionWorker::disconnectRemote()
 {
     if (_client)
         _client->DisconnectAsync();
+    clearWarmClients();
     if (_server)
         _server->DisconnectAll();
 }
@@ -305,10 +429,7 @@ bool SessionWorker::sendAsyncRequest(const QString &target, const proto::OriginM
         return false;
     }
 
-    // Sleep for release something
-    CppCommon::Thread::Yield();
-    CppCommon::Thread::Sleep(1);
-
+    // the calls are matched by the message id, no need to wait the last one
     std::string ip = target.toStdString();
     if (doAsyncRequest(_client.get(), ip, request)) {
         return true;
@@ -321,6 +442,26 @@ bool SessionWorker::sendAsyncRequest(const QString &target, const proto::OriginM
     return false;
 }
 
+bool SessionWorker::sendAsyncRequest(const QString &target, int type, const LoginMessage &msg)
+{
+    return doAsyncData<proto::LoginData>(target, type, msg);
+}
+
+bool SessionWorker::sendAsyncRequest(const QString &target, int type, const ApplyMessage &msg)
+{
+    return doAsyncData<proto::ApplyData>(target, type, msg);
+}
+
+bool SessionWorker::sendAsyncRequest(const QString &target, int type, const TransDataMessage &msg)
+{
+    return doAsyncData<proto::TransData>(target, type, msg);
+}
+
+bool SessionWorker::sendAsyncRequest(const QString &target, int type, const TransCancelMessage &msg)
+{
+    return doAsyncData<proto::CancelData>(target, type, msg);
+}
+
 void SessionWorker::updatePincode(QString code)
 {
     _savedPin = code;
@@ -382,8 +523,19 @@ bool SessionWorker::connect(QString &address, int port)
             LOG << "This target has been conntectd: " << address.toStdString();
             return _client->IsConnected() ? true : _client->ConnectAsync();
         } else {
-            // different target, create new connection.
-            _client->DisconnectAndStop();
+            // different target, keep the current one warm and switch to the target's if any.
+            keepWarmClient(_connectedAddress, _client);
+            auto warm = takeWarmClient(address);
+            if (warm) {
+                LOG << "Switch to the warm connection: " << address.toStdString();
+                _client = warm;
+                _connectedAddress = address;
+                _tryConnect = true;
+                emit onConnectChanged(RPC_CONNECTED, address);
+                return true;
+            }
+
+            // create new connection.
             _client = std::make_shared<ProtoClient>(_asioService, context, address.toStdString(), port);
 
             auto self(this->shared_from_this());
@@ -406,6 +558,100 @@ bool SessionWorker::connect(QString &address, int port)
     return _client->IsConnected();
 }
 
+void SessionWorker::keepWarmClient(const QString &address, std::shared_ptr<ProtoClient> client)
+{
+    // the remotes before 1.2 do not know the parked connection, it would stay connected for them
+    if (address.isEmpty() || !client->IsHandshaked() || !client->typedSupported(address.toStdString())) {
+        client->DisconnectAndStop();
+        return;
+    }
+
+    // both sides take it as disconnected, login again after taking it back
+    client->setWarm(true);
+    _login_hosts.remove(address);
+    emit onConnectChanged(RPC_DISCONNECTED, address);
+
+    QList<std::shared_ptr<ProtoClient>> evicted;
+    {
+        std::scoped_lock locker(_warm_lock);
+        _warm_clients.prepend(qMakePair(address, client));
+        while (_warm_clients.size() > WARM_CLIENTS)
+            evicted.append(_warm_clients.takeLast().second);
+    }
+
+    // disconnect out of the lock, the disconnected state comes back to it
+    for (auto &old : evicted)
+        old->DisconnectAndStop();
+}
+
+std::shared_ptr<ProtoClient> SessionWorker::takeWarmClient(const QString &address)
+{
+    std::shared_ptr<ProtoClient> client { nullptr };
+    {
+        std::scoped_lock locker(_warm_lock);
+        for (int i = 0; i < _warm_clients.size(); ++i) {
+            if (_warm_clients.at(i).first == address) {
+                client = _warm_clients.takeAt(i).second;
+                break;
+            }
+        }
+    }
+
+    if (client && !client->IsHandshaked()) {
+        client->DisconnectAndStop();
+        return nullptr;
+    }
+    // the remote takes it as connected again
+    if (client)
+        client->setWarm(false);
+    return client;
+}
+
+bool SessionWorker::dropWarmClient(const QString &address)
+{
+    std::scoped_lock locker(_warm_lock);
+    for (int i = 0; i < _warm_clients.size(); ++i) {
+        if (_warm_clients.at(i).first == address) {
+            _warm_clients.removeAt(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SessionWorker::closeWarmClient(const QString &address)
+{
+    std::shared_ptr<ProtoClient> client { nullptr };
+    {
+        std::scoped_lock locker(_warm_lock);
+        for (int i = 0; i < _warm_clients.size(); ++i) {
+            if (_warm_clients.at(i).first == address) {
+                client = _warm_clients.takeAt(i).second;
+                break;
+            }
+        }
+    }
+    if (!client)
+        return false;
+
+    // called in the io thread, stop it in the worker thread
+    QMetaObject::invokeMethod(this, [client]() {
+        client->DisconnectAndStop();
+    }, Qt::QueuedConnection);
+    return true;
+}
+
+void SessionWorker::clearWarmClients()
+{
+    QList<QPair<QString, std::shared_ptr<ProtoClient>>> clients;
+    {
+        std::scoped_lock locker(_warm_lock);
+        clients.swap(_warm_clients);
+    }
+    for (auto &it : clients)
+        it.second->DisconnectAndStop();
+}
+
 template<typename T>
 bool SessionWorker::doAsyncRequest(T *endpoint, const std::string& target, const proto::OriginMessage &request)
 {
@@ -419,6 +665,42 @@ bool SessionWorker::doAsyncRequest(T *endpoint, const std::string& target, const
     return false;
 }
 
+template<typename T, typename M>
+bool SessionWorker::doAsyncData(const QString &target, int type, const M &msg)
+{
+    if (target.isEmpty()) {
+        ELOG << "empty target ip!!!";
+        return false;
+    }
+
+    std::string ip = target.toStdString();
+    T request;
+    request.mask = type;
+    toData(msg, &request);
+
+    // the result is reported as the json, the same as the reply of the old remotes
+    DataHandler<T> handler = [this, type](const T *reply) {
+        QString res = "";
+        if (reply) {
+            M result;
+            fromData(*reply, &result);
+            res = QString::fromStdString(result.as_json().serialize());
+        }
+        emit onRpcResult(type, res);
+    };
+
+    if (_client && _client->hasConnected(ip) && _client->typedSupported(ip))
+        return _client->asyncCall<T>(ip, request, REQUEST_TIMEOUT, handler);
+
+    if (_server && _server->hasConnected(ip) && _server->typedSupported(ip))
+        return _server->asyncCall<T>(ip, request, REQUEST_TIMEOUT, handler);
+
+    // the remote has not told its version yet, or it is an old one
+    proto::OriginMessage json;
+    json.mask = type;
+    json.json_msg = msg.as_json().serialize();
+    return sendAsyncRequest(target, json);
+}
 
 void SessionWorker::handleRemoteDisconnected(const QString &remote)
 {
@@ -13,6 +13,13 @@
 
 #include <QObject>
 #include <QMap>
+#include <QList>
+#include <QPair>
+
+#include <mutex>
+
+// the recently used remotes kept connected besides the current one
+#define WARM_CLIENTS 2
 
 class SessionWorker : public QObject, public SessionCallInterface
 {
@@ -22,10 +29,15 @@ public:
     ~SessionWorker();
 
     void onReceivedMessage(const proto::OriginMessage &request, proto::OriginMessage *response) override;
+    bool onReceivedMessage(const proto::LoginData &request, proto::LoginData *response) override;
+    bool onReceivedMessage(const proto::ApplyData &request, proto::ApplyData *response) override;
+    bool onReceivedMessage(const proto::TransData &request, proto::TransData *response) override;
+    bool onReceivedMessage(const proto::CancelData &request, proto::CancelData *response) override;
 
     bool onStateChanged(int state, std::string &msg) override;
 
     void setExtMessageHandler(ExtenMessageHandler cb);
+    void setExtApplyHandler(ExtenApplyHandler cb);
 
     void stop();
     bool startListen(int port);
@@ -35,6 +47,11 @@ public:
 
     QString sendRequest(const QString &target, const proto::OriginMessage &request);
     bool sendAsyncRequest(const QString &target, const proto::OriginMessage &request);
+    // sent as the typed message if the remote supports, or as the json
+    bool sendAsyncRequest(const QString &target, int type, const LoginMessage &msg);
+    bool sendAsyncRequest(const QString &target, int type, const ApplyMessage &msg);
+    bool sendAsyncRequest(const QString &target, int type, const TransDataMessage &msg);
+    bool sendAsyncRequest(const QString &target, int type, const TransCancelMessage &msg);
 
     void updatePincode(QString code);
     void updateLogin(QString ip, bool logined);
@@ -68,19 +85,38 @@ private:
     template<typename T>
     bool doAsyncRequest(T *endpoint, const std::string &target, const proto::OriginMessage &request);
 
+    template<typename T, typename M>
+    bool doAsyncData(const QString &target, int type, const M &msg);
+
+    // switching back to a recent remote reuses its connection, no new connect and handshake.
+    // The parked ones are invisible to their remotes until taken back. The pool is kept here
+    // rather than in SessionManager: the worker creates the clients and receives their states.
+    void keepWarmClient(const QString &address, std::shared_ptr<ProtoClient> client);
+    std::shared_ptr<ProtoClient> takeWarmClient(const QString &address);
+    // the warm one is closed by the remote, return false if not warm
+    bool dropWarmClient(const QString &address);
+    bool closeWarmClient(const QString &address);
+    void clearWarmClients();
+
     std::shared_ptr<AsioService> _asioService;
     // rpc service and client
     std::shared_ptr<ProtoServer> _server { nullptr };
     std::shared_ptr<ProtoClient> _client { nullptr };
 
+    // the states of the warm ones come from the io threads
+    std::mutex _warm_lock;
+    // <address, client>, the recent first
+    QList<QPair<QString, std::shared_ptr<ProtoClient>>> _warm_clients;
+
     ExtenMessageHandler _extMsghandler { nullptr };
+    ExtenApplyHandler _extApplyhandler { nullptr };
 
     QString _savedPin = "";
     QString _accessToken = "";
     QString _connectedAddress = "";
 
     // mark the connection need to retry after disconneted.
-    bool _tryConnect { false };
+    std::atomic<bool> _tryConnect { false };
 
     // <ip, login>
     QMap<QString, bool> _login_hosts;
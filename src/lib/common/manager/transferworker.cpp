@@ -18,12 +18,8 @@ TransferWorker::TransferWorker(QString id, QObject *parent)
     : QObject(parent)
     , _bindId(id)
 {
-    // create own asio service
-    _asioService = std::make_shared<AsioService>();
-    if (!_asioService) {
-        ELOG << "carete ASIO for transfer worker ERROR!";
-    }
-    _asioService->Start();
+    // the download connections are spread over the threads of the shared asio service
+    _asioService = AsioService::shared();
 
     QObject::connect(this, &TransferWorker::speedTimerTick, this, &TransferWorker::handleTimerTick, Qt::QueuedConnection);
     QObject::connect(&_speedTimer, &QTimer::timeout, this, &TransferWorker::doCalculateSpeed, Qt::QueuedConnection);
@@ -167,6 +163,7 @@ bool TransferWorker::tryStartReceive(QStringList names, QString &ip, int port, Q
     std::string accessToken = token.toStdString();
     std::string savePath = dirname.toStdString();
     _file_client->setConfig(accessToken, savePath);
+    _file_client->setIncremental(_incremental);
 
     std::vector<std::string> webs = _file_client->parseWeb(accessToken);
 #ifdef QT_DEBUG
@@ -190,6 +187,11 @@ void TransferWorker::setEveryFileNotify(bool every)
     _everyNotify = every;
 }
 
+void TransferWorker::setIncremental(bool incremental)
+{
+    _incremental = incremental;
+}
+
 bool TransferWorker::isServe()
 {
     return _recvPath.isEmpty();
@@ -35,6 +35,8 @@ public:
 
     bool isSyncing();
     void setEveryFileNotify(bool every);
+    // skip the same files and patch the changed ones in the receive dir
+    void setIncremental(bool incremental);
     bool isServe();
 
 signals:
@@ -71,6 +73,9 @@ private:
     // notify process for every file
     bool _everyNotify { false };
 
+    // incremental sync into the exist files
+    bool _incremental { false };
+
     // files receive path
     QString _recvPath { "" };
 
@@ -169,4 +169,257 @@ std::ostream& operator<<(std::ostream& stream, const DisconnectRequest& value)
     return stream;
 }
 
+LoginData::LoginData()
+    : id(FBE::uuid_t::sequential())
+    , mask((int32_t)0ll)
+    , reply(false)
+    , name()
+    , auth()
+{}
+
+LoginData::LoginData(const FBE::uuid_t& arg_id, int32_t arg_mask, bool arg_reply, const std::string& arg_name, const std::string& arg_auth)
+    : id(arg_id)
+    , mask(arg_mask)
+    , reply(arg_reply)
+    , name(arg_name)
+    , auth(arg_auth)
+{}
+
+bool LoginData::operator==(const LoginData& other) const noexcept
+{
+    return (
+        (id == other.id)
+        );
+}
+
+bool LoginData::operator<(const LoginData& other) const noexcept
+{
+    if (id < other.id)
+        return true;
+    if (other.id < id)
+        return false;
+    return false;
+}
+
+void LoginData::swap(LoginData& other) noexcept
+{
+    using std::swap;
+    swap(id, other.id);
+    swap(mask, other.mask);
+    swap(reply, other.reply);
+    swap(name, other.name);
+    swap(auth, other.auth);
+}
+
+std::ostream& operator<<(std::ostream& stream, const LoginData& value)
+{
+    stream << "LoginData(";
+    stream << "id="; stream << "\"" << value.id << "\"";
+    stream << ",mask="; stream << value.mask;
+    stream << ",reply="; stream << (value.reply ? "true" : "false");
+    stream << ",name="; stream << "\"" << value.name << "\"";
+    stream << ",auth="; stream << "\"" << value.auth << "\"";
+    stream << ")";
+    return stream;
+}
+
+ApplyData::ApplyData()
+    : id(FBE::uuid_t::sequential())
+    , mask((int32_t)0ll)
+    , reply(false)
+    , flag((int64_t)0ll)
+    , nick()
+    , host()
+    , port((int64_t)0ll)
+    , fingerprint()
+{}
+
+ApplyData::ApplyData(const FBE::uuid_t& arg_id, int32_t arg_mask, bool arg_reply, int64_t arg_flag, const std::string& arg_nick, const std::string& arg_host, int64_t arg_port, const std::string& arg_fingerprint)
+    : id(arg_id)
+    , mask(arg_mask)
+    , reply(arg_reply)
+    , flag(arg_flag)
+    , nick(arg_nick)
+    , host(arg_host)
+    , port(arg_port)
+    , fingerprint(arg_fingerprint)
+{}
+
+bool ApplyData::operator==(const ApplyData& other) const noexcept
+{
+    return (
+        (id == other.id)
+        );
+}
+
+bool ApplyData::operator<(const ApplyData& other) const noexcept
+{
+    if (id < other.id)
+        return true;
+    if (other.id < id)
+        return false;
+    return false;
+}
+
+void ApplyData::swap(ApplyData& other) noexcept
+{
+    using std::swap;
+    swap(id, other.id);
+    swap(mask, other.mask);
+    swap(reply, other.reply);
+    swap(flag, other.flag);
+    swap(nick, other.nick);
+    swap(host, other.host);
+    swap(port, other.port);
+    swap(fingerprint, other.fingerprint);
+}
+
+std::ostream& operator<<(std::ostream& stream, const ApplyData& value)
+{
+    stream << "ApplyData(";
+    stream << "id="; stream << "\"" << value.id << "\"";
+    stream << ",mask="; stream << value.mask;
+    stream << ",reply="; stream << (value.reply ? "true" : "false");
+    stream << ",flag="; stream << value.flag;
+    stream << ",nick="; stream << "\"" << value.nick << "\"";
+    stream << ",host="; stream << "\"" << value.host << "\"";
+    stream << ",port="; stream << value.port;
+    stream << ",fingerprint="; stream << "\"" << value.fingerprint << "\"";
+    stream << ")";
+    return stream;
+}
+
+TransData::TransData()
+    : id(FBE::uuid_t::sequential())
+    , mask((int32_t)0ll)
+    , reply(false)
+    , job()
+    , names()
+    , endpoint()
+    , flag(false)
+    , size((int64_t)0ll)
+{}
+
+TransData::TransData(const FBE::uuid_t& arg_id, int32_t arg_mask, bool arg_reply, const std::string& arg_job, const std::vector<std::string>& arg_names, const std::string& arg_endpoint, bool arg_flag, int64_t arg_size)
+    : id(arg_id)
+    , mask(arg_mask)
+    , reply(arg_reply)
+    , job(arg_job)
+    , names(arg_names)
+    , endpoint(arg_endpoint)
+    , flag(arg_flag)
+    , size(arg_size)
+{}
+
+bool TransData::operator==(const TransData& other) const noexcept
+{
+    return (
+        (id == other.id)
+        );
+}
+
+bool TransData::operator<(const TransData& other) const noexcept
+{
+    if (id < other.id)
+        return true;
+    if (other.id < id)
+        return false;
+    return false;
+}
+
+void TransData::swap(TransData& other) noexcept
+{
+    using std::swap;
+    swap(id, other.id);
+    swap(mask, other.mask);
+    swap(reply, other.reply);
+    swap(job, other.job);
+    swap(names, other.names);
+    swap(endpoint, other.endpoint);
+    swap(flag, other.flag);
+    swap(size, other.size);
+}
+
+std::ostream& operator<<(std::ostream& stream, const TransData& value)
+{
+    stream << "TransData(";
+    stream << "id="; stream << "\"" << value.id << "\"";
+    stream << ",mask="; stream << value.mask;
+    stream << ",reply="; stream << (value.reply ? "true" : "false");
+    stream << ",job="; stream << "\"" << value.job << "\"";
+    {
+        bool first = true;
+        stream << ",names=[" << value.names.size() << "][";
+        for (const auto& it : value.names)
+        {
+            stream << std::string(first ? "" : ",") << "\"" << it << "\"";
+            first = false;
+        }
+        stream << "]";
+    }
+    stream << ",endpoint="; stream << "\"" << value.endpoint << "\"";
+    stream << ",flag="; stream << (value.flag ? "true" : "false");
+    stream << ",size="; stream << value.size;
+    stream << ")";
+    return stream;
+}
+
+CancelData::CancelData()
+    : id(FBE::uuid_t::sequential())
+    , mask((int32_t)0ll)
+    , reply(false)
+    , job()
+    , name()
+    , reason()
+{}
+
+CancelData::CancelData(const FBE::uuid_t& arg_id, int32_t arg_mask, bool arg_reply, const std::string& arg_job, const std::string& arg_name, const std::string& arg_reason)
+    : id(arg_id)
+    , mask(arg_mask)
+    , reply(arg_reply)
+    , job(arg_job)
+    , name(arg_name)
+    , reason(arg_reason)
+{}
+
+bool CancelData::operator==(const CancelData& other) const noexcept
+{
+    return (
+        (id == other.id)
+        );
+}
+
+bool CancelData::operator<(const CancelData& other) const noexcept
+{
+    if (id < other.id)
+        return true;
+    if (other.id < id)
+        return false;
+    return false;
+}
+
+void CancelData::swap(CancelData& other) noexcept
+{
+    using std::swap;
+    swap(id, other.id);
+    swap(mask, other.mask);
+    swap(reply, other.reply);
+    swap(job, other.job);
+    swap(name, other.name);
+    swap(reason, other.reason);
+}
+
+std::ostream& operator<<(std::ostream& stream, const CancelData& value)
+{
+    stream << "CancelData(";
+    stream << "id="; stream << "\"" << value.id << "\"";
+    stream << ",mask="; stream << value.mask;
+    stream << ",reply="; stream << (value.reply ? "true" : "false");
+    stream << ",job="; stream << "\"" << value.job << "\"";
+    stream << ",name="; stream << "\"" << value.name << "\"";
+    stream << ",reason="; stream << "\"" << value.reason << "\"";
+    stream << ")";
+    return stream;
+}
+
 } // namespace proto
@@ -241,4 +241,235 @@ struct std::hash<proto::DisconnectRequest>
 
 namespace proto {
 
+struct LoginData
+{
+    FBE::uuid_t id;
+    int32_t mask;
+    bool reply;
+    std::string name;
+    std::string auth;
+
+    size_t fbe_type() const noexcept { return 5; }
+
+    LoginData();
+    LoginData(const FBE::uuid_t& arg_id, int32_t arg_mask, bool arg_reply, const std::string& arg_name, const std::string& arg_auth);
+    LoginData(const LoginData& other) = default;
+    LoginData(LoginData&& other) = default;
+    ~LoginData() = default;
+
+    LoginData& operator=(const LoginData& other) = default;
+    LoginData& operator=(LoginData&& other) = default;
+
+    bool operator==(const LoginData& other) const noexcept;
+    bool operator!=(const LoginData& other) const noexcept { return !operator==(other); }
+    bool operator<(const LoginData& other) const noexcept;
+    bool operator<=(const LoginData& other) const noexcept { return operator<(other) || operator==(other); }
+    bool operator>(const LoginData& other) const noexcept { return !operator<=(other); }
+    bool operator>=(const LoginData& other) const noexcept { return !operator<(other); }
+
+    std::string string() const { std::stringstream ss; ss << *this; return ss.str(); }
+
+    friend std::ostream& operator<<(std::ostream& stream, const LoginData& value);
+
+    void swap(LoginData& other) noexcept;
+    friend void swap(LoginData& value1, LoginData& value2) noexcept { value1.swap(value2); }
+};
+
+} // namespace proto
+
+#if defined(FMT_VERSION) && (FMT_VERSION >= 90000)
+template <> struct fmt::formatter<proto::LoginData> : ostream_formatter {};
+#endif
+
+template<>
+struct std::hash<proto::LoginData>
+{
+    typedef proto::LoginData argument_type;
+    typedef size_t result_type;
+
+    result_type operator() (const argument_type& value) const
+    {
+        result_type result = 17;
+        result = result * 31 + std::hash<decltype(value.id)>()(value.id);
+        return result;
+    }
+};
+
+namespace proto {
+
+struct ApplyData
+{
+    FBE::uuid_t id;
+    int32_t mask;
+    bool reply;
+    int64_t flag;
+    std::string nick;
+    std::string host;
+    int64_t port;
+    std::string fingerprint;
+
+    size_t fbe_type() const noexcept { return 6; }
+
+    ApplyData();
+    ApplyData(const FBE::uuid_t& arg_id, int32_t arg_mask, bool arg_reply, int64_t arg_flag, const std::string& arg_nick, const std::string& arg_host, int64_t arg_port, const std::string& arg_fingerprint);
+    ApplyData(const ApplyData& other) = default;
+    ApplyData(ApplyData&& other) = default;
+    ~ApplyData() = default;
+
+    ApplyData& operator=(const ApplyData& other) = default;
+    ApplyData& operator=(ApplyData&& other) = default;
+
+    bool operator==(const ApplyData& other) const noexcept;
+    bool operator!=(const ApplyData& other) const noexcept { return !operator==(other); }
+    bool operator<(const ApplyData& other) const noexcept;
+    bool operator<=(const ApplyData& other) const noexcept { return operator<(other) || operator==(other); }
+    bool operator>(const ApplyData& other) const noexcept { return !operator<=(other); }
+    bool operator>=(const ApplyData& other) const noexcept { return !operator<(other); }
+
+    std::string string() const { std::stringstream ss; ss << *this; return ss.str(); }
+
+    friend std::ostream& operator<<(std::ostream& stream, const ApplyData& value);
+
+    void swap(ApplyData& other) noexcept;
+    friend void swap(ApplyData& value1, ApplyData& value2) noexcept { value1.swap(value2); }
+};
+
+} // namespace proto
+
+#if defined(FMT_VERSION) && (FMT_VERSION >= 90000)
+template <> struct fmt::formatter<proto::ApplyData> : ostream_formatter {};
+#endif
+
+template<>
+struct std::hash<proto::ApplyData>
+{
+    typedef proto::ApplyData argument_type;
+    typedef size_t result_type;
+
+    result_type operator() (const argument_type& value) const
+    {
+        result_type result = 17;
+        result = result * 31 + std::hash<decltype(value.id)>()(value.id);
+        return result;
+    }
+};
+
+namespace proto {
+
+struct TransData
+{
+    FBE::uuid_t id;
+    int32_t mask;
+    bool reply;
+    std::string job;
+    std::vector<std::string> names;
+    std::string endpoint;
+    bool flag;
+    int64_t size;
+
+    size_t fbe_type() const noexcept { return 7; }
+
+    TransData();
+    TransData(const FBE::uuid_t& arg_id, int32_t arg_mask, bool arg_reply, const std::string& arg_job, const std::vector<std::string>& arg_names, const std::string& arg_endpoint, bool arg_flag, int64_t arg_size);
+    TransData(const TransData& other) = default;
+    TransData(TransData&& other) = default;
+    ~TransData() = default;
+
+    TransData& operator=(const TransData& other) = default;
+    TransData& operator=(TransData&& other) = default;
+
+    bool operator==(const TransData& other) const noexcept;
+    bool operator!=(const TransData& other) const noexcept { return !operator==(other); }
+    bool operator<(const TransData& other) const noexcept;
+    bool operator<=(const TransData& other) const noexcept { return operator<(other) || operator==(other); }
+    bool operator>(const TransData& other) const noexcept { return !operator<=(other); }
+    bool operator>=(const TransData& other) const noexcept { return !operator<(other); }
+
+    std::string string() const { std::stringstream ss; ss << *this; return ss.str(); }
+
+    friend std::ostream& operator<<(std::ostream& stream, const TransData& value);
+
+    void swap(TransData& other) noexcept;
+    friend void swap(TransData& value1, TransData& value2) noexcept { value1.swap(value2); }
+};
+
+} // namespace proto
+
+#if defined(FMT_VERSION) && (FMT_VERSION >= 90000)
+template <> struct fmt::formatter<proto::TransData> : ostream_formatter {};
+#endif
+
+template<>
+struct std::hash<proto::TransData>
+{
+    typedef proto::TransData argument_type;
+    typedef size_t result_type;
+
+    result_type operator() (const argument_type& value) const
+    {
+        result_type result = 17;
+        result = result * 31 + std::hash<decltype(value.id)>()(value.id);
+        return result;
+    }
+};
+
+namespace proto {
+
+struct CancelData
+{
+    FBE::uuid_t id;
+    int32_t mask;
+    bool reply;
+    std::string job;
+    std::string name;
+    std::string reason;
+
+    size_t fbe_type() const noexcept { return 8; }
+
+    CancelData();
+    CancelData(const FBE::uuid_t& arg_id, int32_t arg_mask, bool arg_reply, const std::string& arg_job, const std::string& arg_name, const std::string& arg_reason);
+    CancelData(const CancelData& other) = default;
+    CancelData(CancelData&& other) = default;
+    ~CancelData() = default;
+
+    CancelData& operator=(const CancelData& other) = default;
+    CancelData& operator=(CancelData&& other) = default;
+
+    bool operator==(const CancelData& other) const noexcept;
+    bool operator!=(const CancelData& other) const noexcept { return !operator==(other); }
+    bool operator<(const CancelData& other) const noexcept;
+    bool operator<=(const CancelData& other) const noexcept { return operator<(other) || operator==(other); }
+    bool operator>(const CancelData& other) const noexcept { return !operator<=(other); }
+    bool operator>=(const CancelData& other) const noexcept { return !operator<(other); }
+
+    std::string string() const { std::stringstream ss; ss << *this; return ss.str(); }
+
+    friend std::ostream& operator<<(std::ostream& stream, const CancelData& value);
+
+    void swap(CancelData& other) noexcept;
+    friend void swap(CancelData& value1, CancelData& value2) noexcept { value1.swap(value2); }
+};
+
+} // namespace proto
+
+#if defined(FMT_VERSION) && (FMT_VERSION >= 90000)
+template <> struct fmt::formatter<proto::CancelData> : ostream_formatter {};
+#endif
+
+template<>
+struct std::hash<proto::CancelData>
+{
+    typedef proto::CancelData argument_type;
+    typedef size_t result_type;
+
+    result_type operator() (const argument_type& value) const
+    {
+        result_type result = 17;
+        result = result * 31 + std::hash<decltype(value.id)>()(value.id);
+        return result;
+    }
+};
+
+namespace proto {
+
 } // namespace proto
@@ -583,4 +583,938 @@ size_t DisconnectRequestFinalModel::deserialize(::proto::DisconnectRequest& valu
 
 } // namespace proto
 
+FinalModel<::proto::LoginData>::FinalModel(FBEBuffer& buffer, size_t offset) noexcept : _buffer(buffer), _offset(offset)
+    , id(buffer, 0)
+    , mask(buffer, 0)
+    , reply(buffer, 0)
+    , name(buffer, 0)
+    , auth(buffer, 0)
+{}
+
+size_t FinalModel<::proto::LoginData>::fbe_allocation_size(const ::proto::LoginData& fbe_value) const noexcept
+{
+    size_t fbe_result = 0
+        + id.fbe_allocation_size(fbe_value.id)
+        + mask.fbe_allocation_size(fbe_value.mask)
+        + reply.fbe_allocation_size(fbe_value.reply)
+        + name.fbe_allocation_size(fbe_value.name)
+        + auth.fbe_allocation_size(fbe_value.auth)
+        ;
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::LoginData>::verify() const noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = verify_fields();
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::LoginData>::verify_fields() const noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    name.fbe_offset(fbe_current_offset);
+    fbe_field_size = name.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    auth.fbe_offset(fbe_current_offset);
+    fbe_field_size = auth.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    return fbe_current_offset;
+}
+
+size_t FinalModel<::proto::LoginData>::get(::proto::LoginData& fbe_value) const noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = get_fields(fbe_value);
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::LoginData>::get_fields(::proto::LoginData& fbe_value) const noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_current_size = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.get(fbe_value.id);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.get(fbe_value.mask);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.get(fbe_value.reply);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    name.fbe_offset(fbe_current_offset);
+    fbe_field_size = name.get(fbe_value.name);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    auth.fbe_offset(fbe_current_offset);
+    fbe_field_size = auth.get(fbe_value.auth);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    return fbe_current_size;
+}
+
+size_t FinalModel<::proto::LoginData>::set(const ::proto::LoginData& fbe_value) noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = set_fields(fbe_value);
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::LoginData>::set_fields(const ::proto::LoginData& fbe_value) noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_current_size = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.set(fbe_value.id);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.set(fbe_value.mask);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.set(fbe_value.reply);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    name.fbe_offset(fbe_current_offset);
+    fbe_field_size = name.set(fbe_value.name);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    auth.fbe_offset(fbe_current_offset);
+    fbe_field_size = auth.set(fbe_value.auth);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    return fbe_current_size;
+}
+
+namespace proto {
+
+bool LoginDataFinalModel::verify()
+{
+    if ((this->buffer().offset() + _model.fbe_offset()) > this->buffer().size())
+        return false;
+
+    size_t fbe_struct_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8));
+    size_t fbe_struct_type = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4));
+    if ((fbe_struct_size == 0) || (fbe_struct_type != fbe_type()))
+        return false;
+
+    return ((8 + _model.verify()) == fbe_struct_size);
+}
+
+size_t LoginDataFinalModel::serialize(const ::proto::LoginData& value)
+{
+    size_t fbe_initial_size = this->buffer().size();
+
+    uint32_t fbe_struct_type = (uint32_t)fbe_type();
+    uint32_t fbe_struct_size = (uint32_t)(8 + _model.fbe_allocation_size(value));
+    uint32_t fbe_struct_offset = (uint32_t)(this->buffer().allocate(fbe_struct_size) - this->buffer().offset());
+    assert(((this->buffer().offset() + fbe_struct_offset + fbe_struct_size) <= this->buffer().size()) && "Model is broken!");
+    if ((this->buffer().offset() + fbe_struct_offset + fbe_struct_size) > this->buffer().size())
+        return 0;
+
+    fbe_struct_size = (uint32_t)(8 + _model.set(value));
+    this->buffer().resize(fbe_initial_size + fbe_struct_size);
+
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8)) = fbe_struct_size;
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4)) = fbe_struct_type;
+
+    return fbe_struct_size;
+}
+
+size_t LoginDataFinalModel::deserialize(::proto::LoginData& value) const noexcept
+{
+    assert(((this->buffer().offset() + _model.fbe_offset()) <= this->buffer().size()) && "Model is broken!");
+    if ((this->buffer().offset() + _model.fbe_offset()) > this->buffer().size())
+        return 0;
+
+    size_t fbe_struct_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8));
+    size_t fbe_struct_type = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4));
+    assert(((fbe_struct_size > 0) && (fbe_struct_type == fbe_type())) && "Model is broken!");
+    if ((fbe_struct_size == 0) || (fbe_struct_type != fbe_type()))
+        return 8;
+
+    return 8 + _model.get(value);
+}
+
+} // namespace proto
+
+FinalModel<::proto::ApplyData>::FinalModel(FBEBuffer& buffer, size_t offset) noexcept : _buffer(buffer), _offset(offset)
+    , id(buffer, 0)
+    , mask(buffer, 0)
+    , reply(buffer, 0)
+    , flag(buffer, 0)
+    , nick(buffer, 0)
+    , host(buffer, 0)
+    , port(buffer, 0)
+    , fingerprint(buffer, 0)
+{}
+
+size_t FinalModel<::proto::ApplyData>::fbe_allocation_size(const ::proto::ApplyData& fbe_value) const noexcept
+{
+    size_t fbe_result = 0
+        + id.fbe_allocation_size(fbe_value.id)
+        + mask.fbe_allocation_size(fbe_value.mask)
+        + reply.fbe_allocation_size(fbe_value.reply)
+        + flag.fbe_allocation_size(fbe_value.flag)
+        + nick.fbe_allocation_size(fbe_value.nick)
+        + host.fbe_allocation_size(fbe_value.host)
+        + port.fbe_allocation_size(fbe_value.port)
+        + fingerprint.fbe_allocation_size(fbe_value.fingerprint)
+        ;
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::ApplyData>::verify() const noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = verify_fields();
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::ApplyData>::verify_fields() const noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    flag.fbe_offset(fbe_current_offset);
+    fbe_field_size = flag.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    nick.fbe_offset(fbe_current_offset);
+    fbe_field_size = nick.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    host.fbe_offset(fbe_current_offset);
+    fbe_field_size = host.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    port.fbe_offset(fbe_current_offset);
+    fbe_field_size = port.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    fingerprint.fbe_offset(fbe_current_offset);
+    fbe_field_size = fingerprint.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    return fbe_current_offset;
+}
+
+size_t FinalModel<::proto::ApplyData>::get(::proto::ApplyData& fbe_value) const noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = get_fields(fbe_value);
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::ApplyData>::get_fields(::proto::ApplyData& fbe_value) const noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_current_size = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.get(fbe_value.id);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.get(fbe_value.mask);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.get(fbe_value.reply);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    flag.fbe_offset(fbe_current_offset);
+    fbe_field_size = flag.get(fbe_value.flag);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    nick.fbe_offset(fbe_current_offset);
+    fbe_field_size = nick.get(fbe_value.nick);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    host.fbe_offset(fbe_current_offset);
+    fbe_field_size = host.get(fbe_value.host);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    port.fbe_offset(fbe_current_offset);
+    fbe_field_size = port.get(fbe_value.port);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    fingerprint.fbe_offset(fbe_current_offset);
+    fbe_field_size = fingerprint.get(fbe_value.fingerprint);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    return fbe_current_size;
+}
+
+size_t FinalModel<::proto::ApplyData>::set(const ::proto::ApplyData& fbe_value) noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = set_fields(fbe_value);
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::ApplyData>::set_fields(const ::proto::ApplyData& fbe_value) noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_current_size = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.set(fbe_value.id);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.set(fbe_value.mask);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.set(fbe_value.reply);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    flag.fbe_offset(fbe_current_offset);
+    fbe_field_size = flag.set(fbe_value.flag);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    nick.fbe_offset(fbe_current_offset);
+    fbe_field_size = nick.set(fbe_value.nick);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    host.fbe_offset(fbe_current_offset);
+    fbe_field_size = host.set(fbe_value.host);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    port.fbe_offset(fbe_current_offset);
+    fbe_field_size = port.set(fbe_value.port);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    fingerprint.fbe_offset(fbe_current_offset);
+    fbe_field_size = fingerprint.set(fbe_value.fingerprint);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    return fbe_current_size;
+}
+
+namespace proto {
+
+bool ApplyDataFinalModel::verify()
+{
+    if ((this->buffer().offset() + _model.fbe_offset()) > this->buffer().size())
+        return false;
+
+    size_t fbe_struct_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8));
+    size_t fbe_struct_type = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4));
+    if ((fbe_struct_size == 0) || (fbe_struct_type != fbe_type()))
+        return false;
+
+    return ((8 + _model.verify()) == fbe_struct_size);
+}
+
+size_t ApplyDataFinalModel::serialize(const ::proto::ApplyData& value)
+{
+    size_t fbe_initial_size = this->buffer().size();
+
+    uint32_t fbe_struct_type = (uint32_t)fbe_type();
+    uint32_t fbe_struct_size = (uint32_t)(8 + _model.fbe_allocation_size(value));
+    uint32_t fbe_struct_offset = (uint32_t)(this->buffer().allocate(fbe_struct_size) - this->buffer().offset());
+    assert(((this->buffer().offset() + fbe_struct_offset + fbe_struct_size) <= this->buffer().size()) && "Model is broken!");
+    if ((this->buffer().offset() + fbe_struct_offset + fbe_struct_size) > this->buffer().size())
+        return 0;
+
+    fbe_struct_size = (uint32_t)(8 + _model.set(value));
+    this->buffer().resize(fbe_initial_size + fbe_struct_size);
+
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8)) = fbe_struct_size;
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4)) = fbe_struct_type;
+
+    return fbe_struct_size;
+}
+
+size_t ApplyDataFinalModel::deserialize(::proto::ApplyData& value) const noexcept
+{
+    assert(((this->buffer().offset() + _model.fbe_offset()) <= this->buffer().size()) && "Model is broken!");
+    if ((this->buffer().offset() + _model.fbe_offset()) > this->buffer().size())
+        return 0;
+
+    size_t fbe_struct_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8));
+    size_t fbe_struct_type = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4));
+    assert(((fbe_struct_size > 0) && (fbe_struct_type == fbe_type())) && "Model is broken!");
+    if ((fbe_struct_size == 0) || (fbe_struct_type != fbe_type()))
+        return 8;
+
+    return 8 + _model.get(value);
+}
+
+} // namespace proto
+
+FinalModel<::proto::TransData>::FinalModel(FBEBuffer& buffer, size_t offset) noexcept : _buffer(buffer), _offset(offset)
+    , id(buffer, 0)
+    , mask(buffer, 0)
+    , reply(buffer, 0)
+    , job(buffer, 0)
+    , names(buffer, 0)
+    , endpoint(buffer, 0)
+    , flag(buffer, 0)
+    , size(buffer, 0)
+{}
+
+size_t FinalModel<::proto::TransData>::fbe_allocation_size(const ::proto::TransData& fbe_value) const noexcept
+{
+    size_t fbe_result = 0
+        + id.fbe_allocation_size(fbe_value.id)
+        + mask.fbe_allocation_size(fbe_value.mask)
+        + reply.fbe_allocation_size(fbe_value.reply)
+        + job.fbe_allocation_size(fbe_value.job)
+        + names.fbe_allocation_size(fbe_value.names)
+        + endpoint.fbe_allocation_size(fbe_value.endpoint)
+        + flag.fbe_allocation_size(fbe_value.flag)
+        + size.fbe_allocation_size(fbe_value.size)
+        ;
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::TransData>::verify() const noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = verify_fields();
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::TransData>::verify_fields() const noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    job.fbe_offset(fbe_current_offset);
+    fbe_field_size = job.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    names.fbe_offset(fbe_current_offset);
+    fbe_field_size = names.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    endpoint.fbe_offset(fbe_current_offset);
+    fbe_field_size = endpoint.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    flag.fbe_offset(fbe_current_offset);
+    fbe_field_size = flag.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    size.fbe_offset(fbe_current_offset);
+    fbe_field_size = size.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    return fbe_current_offset;
+}
+
+size_t FinalModel<::proto::TransData>::get(::proto::TransData& fbe_value) const noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = get_fields(fbe_value);
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::TransData>::get_fields(::proto::TransData& fbe_value) const noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_current_size = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.get(fbe_value.id);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.get(fbe_value.mask);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.get(fbe_value.reply);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    job.fbe_offset(fbe_current_offset);
+    fbe_field_size = job.get(fbe_value.job);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    names.fbe_offset(fbe_current_offset);
+    fbe_field_size = names.get(fbe_value.names);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    endpoint.fbe_offset(fbe_current_offset);
+    fbe_field_size = endpoint.get(fbe_value.endpoint);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    flag.fbe_offset(fbe_current_offset);
+    fbe_field_size = flag.get(fbe_value.flag);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    size.fbe_offset(fbe_current_offset);
+    fbe_field_size = size.get(fbe_value.size);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    return fbe_current_size;
+}
+
+size_t FinalModel<::proto::TransData>::set(const ::proto::TransData& fbe_value) noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = set_fields(fbe_value);
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::TransData>::set_fields(const ::proto::TransData& fbe_value) noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_current_size = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.set(fbe_value.id);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.set(fbe_value.mask);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.set(fbe_value.reply);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    job.fbe_offset(fbe_current_offset);
+    fbe_field_size = job.set(fbe_value.job);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    names.fbe_offset(fbe_current_offset);
+    fbe_field_size = names.set(fbe_value.names);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    endpoint.fbe_offset(fbe_current_offset);
+    fbe_field_size = endpoint.set(fbe_value.endpoint);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    flag.fbe_offset(fbe_current_offset);
+    fbe_field_size = flag.set(fbe_value.flag);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    size.fbe_offset(fbe_current_offset);
+    fbe_field_size = size.set(fbe_value.size);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    return fbe_current_size;
+}
+
+namespace proto {
+
+bool TransDataFinalModel::verify()
+{
+    if ((this->buffer().offset() + _model.fbe_offset()) > this->buffer().size())
+        return false;
+
+    size_t fbe_struct_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8));
+    size_t fbe_struct_type = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4));
+    if ((fbe_struct_size == 0) || (fbe_struct_type != fbe_type()))
+        return false;
+
+    return ((8 + _model.verify()) == fbe_struct_size);
+}
+
+size_t TransDataFinalModel::serialize(const ::proto::TransData& value)
+{
+    size_t fbe_initial_size = this->buffer().size();
+
+    uint32_t fbe_struct_type = (uint32_t)fbe_type();
+    uint32_t fbe_struct_size = (uint32_t)(8 + _model.fbe_allocation_size(value));
+    uint32_t fbe_struct_offset = (uint32_t)(this->buffer().allocate(fbe_struct_size) - this->buffer().offset());
+    assert(((this->buffer().offset() + fbe_struct_offset + fbe_struct_size) <= this->buffer().size()) && "Model is broken!");
+    if ((this->buffer().offset() + fbe_struct_offset + fbe_struct_size) > this->buffer().size())
+        return 0;
+
+    fbe_struct_size = (uint32_t)(8 + _model.set(value));
+    this->buffer().resize(fbe_initial_size + fbe_struct_size);
+
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8)) = fbe_struct_size;
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4)) = fbe_struct_type;
+
+    return fbe_struct_size;
+}
+
+size_t TransDataFinalModel::deserialize(::proto::TransData& value) const noexcept
+{
+    assert(((this->buffer().offset() + _model.fbe_offset()) <= this->buffer().size()) && "Model is broken!");
+    if ((this->buffer().offset() + _model.fbe_offset()) > this->buffer().size())
+        return 0;
+
+    size_t fbe_struct_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8));
+    size_t fbe_struct_type = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4));
+    assert(((fbe_struct_size > 0) && (fbe_struct_type == fbe_type())) && "Model is broken!");
+    if ((fbe_struct_size == 0) || (fbe_struct_type != fbe_type()))
+        return 8;
+
+    return 8 + _model.get(value);
+}
+
+} // namespace proto
+
+FinalModel<::proto::CancelData>::FinalModel(FBEBuffer& buffer, size_t offset) noexcept : _buffer(buffer), _offset(offset)
+    , id(buffer, 0)
+    , mask(buffer, 0)
+    , reply(buffer, 0)
+    , job(buffer, 0)
+    , name(buffer, 0)
+    , reason(buffer, 0)
+{}
+
+size_t FinalModel<::proto::CancelData>::fbe_allocation_size(const ::proto::CancelData& fbe_value) const noexcept
+{
+    size_t fbe_result = 0
+        + id.fbe_allocation_size(fbe_value.id)
+        + mask.fbe_allocation_size(fbe_value.mask)
+        + reply.fbe_allocation_size(fbe_value.reply)
+        + job.fbe_allocation_size(fbe_value.job)
+        + name.fbe_allocation_size(fbe_value.name)
+        + reason.fbe_allocation_size(fbe_value.reason)
+        ;
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::CancelData>::verify() const noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = verify_fields();
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::CancelData>::verify_fields() const noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    job.fbe_offset(fbe_current_offset);
+    fbe_field_size = job.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    name.fbe_offset(fbe_current_offset);
+    fbe_field_size = name.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    reason.fbe_offset(fbe_current_offset);
+    fbe_field_size = reason.verify();
+    if (fbe_field_size == std::numeric_limits<std::size_t>::max())
+        return std::numeric_limits<std::size_t>::max();
+    fbe_current_offset += fbe_field_size;
+
+    return fbe_current_offset;
+}
+
+size_t FinalModel<::proto::CancelData>::get(::proto::CancelData& fbe_value) const noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = get_fields(fbe_value);
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::CancelData>::get_fields(::proto::CancelData& fbe_value) const noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_current_size = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.get(fbe_value.id);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.get(fbe_value.mask);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.get(fbe_value.reply);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    job.fbe_offset(fbe_current_offset);
+    fbe_field_size = job.get(fbe_value.job);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    name.fbe_offset(fbe_current_offset);
+    fbe_field_size = name.get(fbe_value.name);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    reason.fbe_offset(fbe_current_offset);
+    fbe_field_size = reason.get(fbe_value.reason);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    return fbe_current_size;
+}
+
+size_t FinalModel<::proto::CancelData>::set(const ::proto::CancelData& fbe_value) noexcept
+{
+    _buffer.shift(fbe_offset());
+    size_t fbe_result = set_fields(fbe_value);
+    _buffer.unshift(fbe_offset());
+    return fbe_result;
+}
+
+size_t FinalModel<::proto::CancelData>::set_fields(const ::proto::CancelData& fbe_value) noexcept
+{
+    size_t fbe_current_offset = 0;
+    size_t fbe_current_size = 0;
+    size_t fbe_field_size;
+
+    id.fbe_offset(fbe_current_offset);
+    fbe_field_size = id.set(fbe_value.id);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    mask.fbe_offset(fbe_current_offset);
+    fbe_field_size = mask.set(fbe_value.mask);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    reply.fbe_offset(fbe_current_offset);
+    fbe_field_size = reply.set(fbe_value.reply);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    job.fbe_offset(fbe_current_offset);
+    fbe_field_size = job.set(fbe_value.job);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    name.fbe_offset(fbe_current_offset);
+    fbe_field_size = name.set(fbe_value.name);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    reason.fbe_offset(fbe_current_offset);
+    fbe_field_size = reason.set(fbe_value.reason);
+    fbe_current_offset += fbe_field_size;
+    fbe_current_size += fbe_field_size;
+
+    return fbe_current_size;
+}
+
+namespace proto {
+
+bool CancelDataFinalModel::verify()
+{
+    if ((this->buffer().offset() + _model.fbe_offset()) > this->buffer().size())
+        return false;
+
+    size_t fbe_struct_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8));
+    size_t fbe_struct_type = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4));
+    if ((fbe_struct_size == 0) || (fbe_struct_type != fbe_type()))
+        return false;
+
+    return ((8 + _model.verify()) == fbe_struct_size);
+}
+
+size_t CancelDataFinalModel::serialize(const ::proto::CancelData& value)
+{
+    size_t fbe_initial_size = this->buffer().size();
+
+    uint32_t fbe_struct_type = (uint32_t)fbe_type();
+    uint32_t fbe_struct_size = (uint32_t)(8 + _model.fbe_allocation_size(value));
+    uint32_t fbe_struct_offset = (uint32_t)(this->buffer().allocate(fbe_struct_size) - this->buffer().offset());
+    assert(((this->buffer().offset() + fbe_struct_offset + fbe_struct_size) <= this->buffer().size()) && "Model is broken!");
+    if ((this->buffer().offset() + fbe_struct_offset + fbe_struct_size) > this->buffer().size())
+        return 0;
+
+    fbe_struct_size = (uint32_t)(8 + _model.set(value));
+    this->buffer().resize(fbe_initial_size + fbe_struct_size);
+
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8)) = fbe_struct_size;
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4)) = fbe_struct_type;
+
+    return fbe_struct_size;
+}
+
+size_t CancelDataFinalModel::deserialize(::proto::CancelData& value) const noexcept
+{
+    assert(((this->buffer().offset() + _model.fbe_offset()) <= this->buffer().size()) && "Model is broken!");
+    if ((this->buffer().offset() + _model.fbe_offset()) > this->buffer().size())
+        return 0;
+
+    size_t fbe_struct_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 8));
+    size_t fbe_struct_type = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + _model.fbe_offset() - 4));
+    assert(((fbe_struct_size > 0) && (fbe_struct_type == fbe_type())) && "Model is broken!");
+    if ((fbe_struct_size == 0) || (fbe_struct_type != fbe_type()))
+        return 8;
+
+    return 8 + _model.get(value);
+}
+
+} // namespace proto
+
 } // namespace FBE
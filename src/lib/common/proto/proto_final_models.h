@@ -316,4 +316,319 @@ private:
 
 } // namespace proto
 
+// Fast Binary Encoding ::proto::LoginData final model
+template <>
+class FinalModel<::proto::LoginData>
+{
+public:
+    FinalModel(FBEBuffer& buffer, size_t offset) noexcept;
+
+    // Get the allocation size
+    size_t fbe_allocation_size(const ::proto::LoginData& fbe_value) const noexcept;
+    // Get the final offset
+    size_t fbe_offset() const noexcept { return _offset; }
+    // Set the final offset
+    size_t fbe_offset(size_t offset) const noexcept { return _offset = offset; }
+    // Get the final type
+    static constexpr size_t fbe_type() noexcept { return 5; }
+
+    // Shift the current final offset
+    void fbe_shift(size_t size) noexcept { _offset += size; }
+    // Unshift the current final offset
+    void fbe_unshift(size_t size) noexcept { _offset -= size; }
+
+    // Check if the struct value is valid
+    size_t verify() const noexcept;
+    // Check if the struct fields are valid
+    size_t verify_fields() const noexcept;
+
+    // Get the struct value
+    size_t get(::proto::LoginData& fbe_value) const noexcept;
+    // Get the struct fields values
+    size_t get_fields(::proto::LoginData& fbe_value) const noexcept;
+
+    // Set the struct value
+    size_t set(const ::proto::LoginData& fbe_value) noexcept;
+    // Set the struct fields values
+    size_t set_fields(const ::proto::LoginData& fbe_value) noexcept;
+
+private:
+    FBEBuffer& _buffer;
+    mutable size_t _offset;
+
+public:
+    FinalModel<FBE::uuid_t> id;
+    FinalModel<int32_t> mask;
+    FinalModel<bool> reply;
+    FinalModel<std::string> name;
+    FinalModel<std::string> auth;
+};
+
+namespace proto {
+
+// Fast Binary Encoding LoginData final model
+class LoginDataFinalModel : public FBE::Model
+{
+public:
+    LoginDataFinalModel() : _model(this->buffer(), 8) {}
+    LoginDataFinalModel(const std::shared_ptr<FBEBuffer>& buffer) : FBE::Model(buffer), _model(this->buffer(), 8) {}
+
+    // Get the model type
+    static constexpr size_t fbe_type() noexcept { return FinalModel<::proto::LoginData>::fbe_type(); }
+
+    // Check if the struct value is valid
+    bool verify();
+
+    // Serialize the struct value
+    size_t serialize(const ::proto::LoginData& value);
+    // Deserialize the struct value
+    size_t deserialize(::proto::LoginData& value) const noexcept;
+
+    // Move to the next struct value
+    void next(size_t prev) noexcept { _model.fbe_shift(prev); }
+
+private:
+    FinalModel<::proto::LoginData> _model;
+};
+
+} // namespace proto
+
+// Fast Binary Encoding ::proto::ApplyData final model
+template <>
+class FinalModel<::proto::ApplyData>
+{
+public:
+    FinalModel(FBEBuffer& buffer, size_t offset) noexcept;
+
+    // Get the allocation size
+    size_t fbe_allocation_size(const ::proto::ApplyData& fbe_value) const noexcept;
+    // Get the final offset
+    size_t fbe_offset() const noexcept { return _offset; }
+    // Set the final offset
+    size_t fbe_offset(size_t offset) const noexcept { return _offset = offset; }
+    // Get the final type
+    static constexpr size_t fbe_type() noexcept { return 6; }
+
+    // Shift the current final offset
+    void fbe_shift(size_t size) noexcept { _offset += size; }
+    // Unshift the current final offset
+    void fbe_unshift(size_t size) noexcept { _offset -= size; }
+
+    // Check if the struct value is valid
+    size_t verify() const noexcept;
+    // Check if the struct fields are valid
+    size_t verify_fields() const noexcept;
+
+    // Get the struct value
+    size_t get(::proto::ApplyData& fbe_value) const noexcept;
+    // Get the struct fields values
+    size_t get_fields(::proto::ApplyData& fbe_value) const noexcept;
+
+    // Set the struct value
+    size_t set(const ::proto::ApplyData& fbe_value) noexcept;
+    // Set the struct fields values
+    size_t set_fields(const ::proto::ApplyData& fbe_value) noexcept;
+
+private:
+    FBEBuffer& _buffer;
+    mutable size_t _offset;
+
+public:
+    FinalModel<FBE::uuid_t> id;
+    FinalModel<int32_t> mask;
+    FinalModel<bool> reply;
+    FinalModel<int64_t> flag;
+    FinalModel<std::string> nick;
+    FinalModel<std::string> host;
+    FinalModel<int64_t> port;
+    FinalModel<std::string> fingerprint;
+};
+
+namespace proto {
+
+// Fast Binary Encoding ApplyData final model
+class ApplyDataFinalModel : public FBE::Model
+{
+public:
+    ApplyDataFinalModel() : _model(this->buffer(), 8) {}
+    ApplyDataFinalModel(const std::shared_ptr<FBEBuffer>& buffer) : FBE::Model(buffer), _model(this->buffer(), 8) {}
+
+    // Get the model type
+    static constexpr size_t fbe_type() noexcept { return FinalModel<::proto::ApplyData>::fbe_type(); }
+
+    // Check if the struct value is valid
+    bool verify();
+
+    // Serialize the struct value
+    size_t serialize(const ::proto::ApplyData& value);
+    // Deserialize the struct value
+    size_t deserialize(::proto::ApplyData& value) const noexcept;
+
+    // Move to the next struct value
+    void next(size_t prev) noexcept { _model.fbe_shift(prev); }
+
+private:
+    FinalModel<::proto::ApplyData> _model;
+};
+
+} // namespace proto
+
+// Fast Binary Encoding ::proto::TransData final model
+template <>
+class FinalModel<::proto::TransData>
+{
+public:
+    FinalModel(FBEBuffer& buffer, size_t offset) noexcept;
+
+    // Get the allocation size
+    size_t fbe_allocation_size(const ::proto::TransData& fbe_value) const noexcept;
+    // Get the final offset
+    size_t fbe_offset() const noexcept { return _offset; }
+    // Set the final offset
+    size_t fbe_offset(size_t offset) const noexcept { return _offset = offset; }
+    // Get the final type
+    static constexpr size_t fbe_type() noexcept { return 7; }
+
+    // Shift the current final offset
+    void fbe_shift(size_t size) noexcept { _offset += size; }
+    // Unshift the current final offset
+    void fbe_unshift(size_t size) noexcept { _offset -= size; }
+
+    // Check if the struct value is valid
+    size_t verify() const noexcept;
+    // Check if the struct fields are valid
+    size_t verify_fields() const noexcept;
+
+    // Get the struct value
+    size_t get(::proto::TransData& fbe_value) const noexcept;
+    // Get the struct fields values
+    size_t get_fields(::proto::TransData& fbe_value) const noexcept;
+
+    // Set the struct value
+    size_t set(const ::proto::TransData& fbe_value) noexcept;
+    // Set the struct fields values
+    size_t set_fields(const ::proto::TransData& fbe_value) noexcept;
+
+private:
+    FBEBuffer& _buffer;
+    mutable size_t _offset;
+
+public:
+    FinalModel<FBE::uuid_t> id;
+    FinalModel<int32_t> mask;
+    FinalModel<bool> reply;
+    FinalModel<std::string> job;
+    FinalModelVector<std::string> names;
+    FinalModel<std::string> endpoint;
+    FinalModel<bool> flag;
+    FinalModel<int64_t> size;
+};
+
+namespace proto {
+
+// Fast Binary Encoding TransData final model
+class TransDataFinalModel : public FBE::Model
+{
+public:
+    TransDataFinalModel() : _model(this->buffer(), 8) {}
+    TransDataFinalModel(const std::shared_ptr<FBEBuffer>& buffer) : FBE::Model(buffer), _model(this->buffer(), 8) {}
+
+    // Get the model type
+    static constexpr size_t fbe_type() noexcept { return FinalModel<::proto::TransData>::fbe_type(); }
+
+    // Check if the struct value is valid
+    bool verify();
+
+    // Serialize the struct value
+    size_t serialize(const ::proto::TransData& value);
+    // Deserialize the struct value
+    size_t deserialize(::proto::TransData& value) const noexcept;
+
+    // Move to the next struct value
+    void next(size_t prev) noexcept { _model.fbe_shift(prev); }
+
+private:
+    FinalModel<::proto::TransData> _model;
+};
+
+} // namespace proto
+
+// Fast Binary Encoding ::proto::CancelData final model
+template <>
+class FinalModel<::proto::CancelData>
+{
+public:
+    FinalModel(FBEBuffer& buffer, size_t offset) noexcept;
+
+    // Get the allocation size
+    size_t fbe_allocation_size(const ::proto::CancelData& fbe_value) const noexcept;
+    // Get the final offset
+    size_t fbe_offset() const noexcept { return _offset; }
+    // Set the final offset
+    size_t fbe_offset(size_t offset) const noexcept { return _offset = offset; }
+    // Get the final type
+    static constexpr size_t fbe_type() noexcept { return 8; }
+
+    // Shift the current final offset
+    void fbe_shift(size_t size) noexcept { _offset += size; }
+    // Unshift the current final offset
+    void fbe_unshift(size_t size) noexcept { _offset -= size; }
+
+    // Check if the struct value is valid
+    size_t verify() const noexcept;
+    // Check if the struct fields are valid
+    size_t verify_fields() const noexcept;
+
+    // Get the struct value
+    size_t get(::proto::CancelData& fbe_value) const noexcept;
+    // Get the struct fields values
+    size_t get_fields(::proto::CancelData& fbe_value) const noexcept;
+
+    // Set the struct value
+    size_t set(const ::proto::CancelData& fbe_value) noexcept;
+    // Set the struct fields values
+    size_t set_fields(const ::proto::CancelData& fbe_value) noexcept;
+
+private:
+    FBEBuffer& _buffer;
+    mutable size_t _offset;
+
+public:
+    FinalModel<FBE::uuid_t> id;
+    FinalModel<int32_t> mask;
+    FinalModel<bool> reply;
+    FinalModel<std::string> job;
+    FinalModel<std::string> name;
+    FinalModel<std::string> reason;
+};
+
+namespace proto {
+
+// Fast Binary Encoding CancelData final model
+class CancelDataFinalModel : public FBE::Model
+{
+public:
+    CancelDataFinalModel() : _model(this->buffer(), 8) {}
+    CancelDataFinalModel(const std::shared_ptr<FBEBuffer>& buffer) : FBE::Model(buffer), _model(this->buffer(), 8) {}
+
+    // Get the model type
+    static constexpr size_t fbe_type() noexcept { return FinalModel<::proto::CancelData>::fbe_type(); }
+
+    // Check if the struct value is valid
+    bool verify();
+
+    // Serialize the struct value
+    size_t serialize(const ::proto::CancelData& value);
+    // Deserialize the struct value
+    size_t deserialize(::proto::CancelData& value) const noexcept;
+
+    // Move to the next struct value
+    void next(size_t prev) noexcept { _model.fbe_shift(prev); }
+
+private:
+    FinalModel<::proto::CancelData> _model;
+};
+
+} // namespace proto
+
 } // namespace FBE
@@ -88,6 +88,78 @@ size_t FinalSender::send(const ::proto::DisconnectRequest& value)
     return this->send_serialized(serialized);
 }
 
+size_t FinalSender::send(const ::proto::LoginData& value)
+{
+    // Serialize the value into the FBE stream
+    size_t serialized = LoginDataModel.serialize(value);
+    assert((serialized > 0) && "proto::LoginData serialization failed!");
+    assert(LoginDataModel.verify() && "proto::LoginData validation failed!");
+
+    // Log the value
+    if (this->_logging)
+    {
+        std::string message = value.string();
+        this->onSendLog(message);
+    }
+
+    // Send the serialized value
+    return this->send_serialized(serialized);
+}
+
+size_t FinalSender::send(const ::proto::ApplyData& value)
+{
+    // Serialize the value into the FBE stream
+    size_t serialized = ApplyDataModel.serialize(value);
+    assert((serialized > 0) && "proto::ApplyData serialization failed!");
+    assert(ApplyDataModel.verify() && "proto::ApplyData validation failed!");
+
+    // Log the value
+    if (this->_logging)
+    {
+        std::string message = value.string();
+        this->onSendLog(message);
+    }
+
+    // Send the serialized value
+    return this->send_serialized(serialized);
+}
+
+size_t FinalSender::send(const ::proto::TransData& value)
+{
+    // Serialize the value into the FBE stream
+    size_t serialized = TransDataModel.serialize(value);
+    assert((serialized > 0) && "proto::TransData serialization failed!");
+    assert(TransDataModel.verify() && "proto::TransData validation failed!");
+
+    // Log the value
+    if (this->_logging)
+    {
+        std::string message = value.string();
+        this->onSendLog(message);
+    }
+
+    // Send the serialized value
+    return this->send_serialized(serialized);
+}
+
+size_t FinalSender::send(const ::proto::CancelData& value)
+{
+    // Serialize the value into the FBE stream
+    size_t serialized = CancelDataModel.serialize(value);
+    assert((serialized > 0) && "proto::CancelData serialization failed!");
+    assert(CancelDataModel.verify() && "proto::CancelData validation failed!");
+
+    // Log the value
+    if (this->_logging)
+    {
+        std::string message = value.string();
+        this->onSendLog(message);
+    }
+
+    // Send the serialized value
+    return this->send_serialized(serialized);
+}
+
 bool FinalReceiver::onReceive(size_t type, const void* data, size_t size)
 {
     switch (type)
@@ -168,6 +240,82 @@ bool FinalReceiver::onReceive(size_t type, const void* data, size_t size)
             onReceive(DisconnectRequestValue);
             return true;
         }
+        case FBE::proto::LoginDataFinalModel::fbe_type():
+        {
+            // Deserialize the value from the FBE stream
+            LoginDataModel.attach(data, size);
+            assert(LoginDataModel.verify() && "proto::LoginData validation failed!");
+            [[maybe_unused]] size_t deserialized = LoginDataModel.deserialize(LoginDataValue);
+            assert((deserialized > 0) && "proto::LoginData deserialization failed!");
+
+            // Log the value
+            if (this->_logging)
+            {
+                std::string message = LoginDataValue.string();
+                this->onReceiveLog(message);
+            }
+
+            // Call receive handler with deserialized value
+            onReceive(LoginDataValue);
+            return true;
+        }
+        case FBE::proto::ApplyDataFinalModel::fbe_type():
+        {
+            // Deserialize the value from the FBE stream
+            ApplyDataModel.attach(data, size);
+            assert(ApplyDataModel.verify() && "proto::ApplyData validation failed!");
+            [[maybe_unused]] size_t deserialized = ApplyDataModel.deserialize(ApplyDataValue);
+            assert((deserialized > 0) && "proto::ApplyData deserialization failed!");
+
+            // Log the value
+            if (this->_logging)
+            {
+                std::string message = ApplyDataValue.string();
+                this->onReceiveLog(message);
+            }
+
+            // Call receive handler with deserialized value
+            onReceive(ApplyDataValue);
+            return true;
+        }
+        case FBE::proto::TransDataFinalModel::fbe_type():
+        {
+            // Deserialize the value from the FBE stream
+            TransDataModel.attach(data, size);
+            assert(TransDataModel.verify() && "proto::TransData validation failed!");
+            [[maybe_unused]] size_t deserialized = TransDataModel.deserialize(TransDataValue);
+            assert((deserialized > 0) && "proto::TransData deserialization failed!");
+
+            // Log the value
+            if (this->_logging)
+            {
+                std::string message = TransDataValue.string();
+                this->onReceiveLog(message);
+            }
+
+            // Call receive handler with deserialized value
+            onReceive(TransDataValue);
+            return true;
+        }
+        case FBE::proto::CancelDataFinalModel::fbe_type():
+        {
+            // Deserialize the value from the FBE stream
+            CancelDataModel.attach(data, size);
+            assert(CancelDataModel.verify() && "proto::CancelData validation failed!");
+            [[maybe_unused]] size_t deserialized = CancelDataModel.deserialize(CancelDataValue);
+            assert((deserialized > 0) && "proto::CancelData deserialization failed!");
+
+            // Log the value
+            if (this->_logging)
+            {
+                std::string message = CancelDataValue.string();
+                this->onReceiveLog(message);
+            }
+
+            // Call receive handler with deserialized value
+            onReceive(CancelDataValue);
+            return true;
+        }
         default: break;
     }
 
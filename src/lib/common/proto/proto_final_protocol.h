@@ -29,7 +29,7 @@ struct ProtocolVersion
     // Protocol major version
     static const int major = 1;
     // Protocol minor version
-    static const int minor = 0;
+    static const int minor = 2;
 };
 
 // Fast Binary Encoding proto final sender
@@ -41,6 +41,10 @@ public:
         , MessageRejectModel(this->_buffer)
         , MessageNotifyModel(this->_buffer)
         , DisconnectRequestModel(this->_buffer)
+        , LoginDataModel(this->_buffer)
+        , ApplyDataModel(this->_buffer)
+        , TransDataModel(this->_buffer)
+        , CancelDataModel(this->_buffer)
     { this->final(true); }
     FinalSender(const FinalSender&) = delete;
     FinalSender(FinalSender&&) noexcept = delete;
@@ -53,6 +57,10 @@ public:
     size_t send(const ::proto::MessageReject& value);
     size_t send(const ::proto::MessageNotify& value);
     size_t send(const ::proto::DisconnectRequest& value);
+    size_t send(const ::proto::LoginData& value);
+    size_t send(const ::proto::ApplyData& value);
+    size_t send(const ::proto::TransData& value);
+    size_t send(const ::proto::CancelData& value);
 
 public:
     // Sender models accessors
@@ -60,6 +68,10 @@ public:
     FBE::proto::MessageRejectFinalModel MessageRejectModel;
     FBE::proto::MessageNotifyFinalModel MessageNotifyModel;
     FBE::proto::DisconnectRequestFinalModel DisconnectRequestModel;
+    FBE::proto::LoginDataFinalModel LoginDataModel;
+    FBE::proto::ApplyDataFinalModel ApplyDataModel;
+    FBE::proto::TransDataFinalModel TransDataModel;
+    FBE::proto::CancelDataFinalModel CancelDataModel;
 };
 
 // Fast Binary Encoding proto final receiver
@@ -80,6 +92,10 @@ protected:
     virtual void onReceive(const ::proto::MessageReject& value) {}
     virtual void onReceive(const ::proto::MessageNotify& value) {}
     virtual void onReceive(const ::proto::DisconnectRequest& value) {}
+    virtual void onReceive(const ::proto::LoginData& value) {}
+    virtual void onReceive(const ::proto::ApplyData& value) {}
+    virtual void onReceive(const ::proto::TransData& value) {}
+    virtual void onReceive(const ::proto::CancelData& value) {}
 
     // Receive message handler
     bool onReceive(size_t type, const void* data, size_t size) override;
@@ -90,12 +106,20 @@ private:
     ::proto::MessageReject MessageRejectValue;
     ::proto::MessageNotify MessageNotifyValue;
     ::proto::DisconnectRequest DisconnectRequestValue;
+    ::proto::LoginData LoginDataValue;
+    ::proto::ApplyData ApplyDataValue;
+    ::proto::TransData TransDataValue;
+    ::proto::CancelData CancelDataValue;
 
     // Receiver models accessors
     FBE::proto::OriginMessageFinalModel OriginMessageModel;
     FBE::proto::MessageRejectFinalModel MessageRejectModel;
     FBE::proto::MessageNotifyFinalModel MessageNotifyModel;
     FBE::proto::DisconnectRequestFinalModel DisconnectRequestModel;
+    FBE::proto::LoginDataFinalModel LoginDataModel;
+    FBE::proto::ApplyDataFinalModel ApplyDataModel;
+    FBE::proto::TransDataFinalModel TransDataModel;
+    FBE::proto::CancelDataFinalModel CancelDataModel;
 };
 
 // Fast Binary Encoding proto final client
@@ -128,22 +152,38 @@ protected:
     virtual bool onReceiveResponse(const ::proto::MessageReject& response) { return false; }
     virtual bool onReceiveResponse(const ::proto::MessageNotify& response) { return false; }
     virtual bool onReceiveResponse(const ::proto::DisconnectRequest& response) { return false; }
+    virtual bool onReceiveResponse(const ::proto::LoginData& response) { return false; }
+    virtual bool onReceiveResponse(const ::proto::ApplyData& response) { return false; }
+    virtual bool onReceiveResponse(const ::proto::TransData& response) { return false; }
+    virtual bool onReceiveResponse(const ::proto::CancelData& response) { return false; }
 
     virtual bool onReceiveReject(const ::proto::MessageReject& reject);
 
     virtual bool onReceiveReject(const ::proto::OriginMessage& reject) { return false; }
     virtual bool onReceiveReject(const ::proto::MessageNotify& reject) { return false; }
     virtual bool onReceiveReject(const ::proto::DisconnectRequest& reject) { return false; }
+    virtual bool onReceiveReject(const ::proto::LoginData& reject) { return false; }
+    virtual bool onReceiveReject(const ::proto::ApplyData& reject) { return false; }
+    virtual bool onReceiveReject(const ::proto::TransData& reject) { return false; }
+    virtual bool onReceiveReject(const ::proto::CancelData& reject) { return false; }
 
     virtual void onReceiveNotify(const ::proto::OriginMessage& notify) {}
     virtual void onReceiveNotify(const ::proto::MessageReject& notify) {}
     virtual void onReceiveNotify(const ::proto::MessageNotify& notify) {}
     virtual void onReceiveNotify(const ::proto::DisconnectRequest& notify) {}
+    virtual void onReceiveNotify(const ::proto::LoginData& notify) {}
+    virtual void onReceiveNotify(const ::proto::ApplyData& notify) {}
+    virtual void onReceiveNotify(const ::proto::TransData& notify) {}
+    virtual void onReceiveNotify(const ::proto::CancelData& notify) {}
 
     virtual void onReceive(const ::proto::OriginMessage& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
     virtual void onReceive(const ::proto::MessageReject& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
     virtual void onReceive(const ::proto::MessageNotify& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
     virtual void onReceive(const ::proto::DisconnectRequest& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
+    virtual void onReceive(const ::proto::LoginData& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
+    virtual void onReceive(const ::proto::ApplyData& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
+    virtual void onReceive(const ::proto::TransData& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
+    virtual void onReceive(const ::proto::CancelData& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
 
     // Reset client requests
     virtual void reset_requests();
@@ -881,4 +881,1196 @@ size_t DisconnectRequestModel::deserialize(::proto::DisconnectRequest& value) co
 
 } // namespace proto
 
+FieldModel<::proto::LoginData>::FieldModel(FBEBuffer& buffer, size_t offset) noexcept : _buffer(buffer), _offset(offset)
+    , id(buffer, 4 + 4)
+    , mask(buffer, id.fbe_offset() + id.fbe_size())
+    , reply(buffer, mask.fbe_offset() + mask.fbe_size())
+    , name(buffer, reply.fbe_offset() + reply.fbe_size())
+    , auth(buffer, name.fbe_offset() + name.fbe_size())
+{}
+
+size_t FieldModel<::proto::LoginData>::fbe_body() const noexcept
+{
+    size_t fbe_result = 4 + 4
+        + id.fbe_size()
+        + mask.fbe_size()
+        + reply.fbe_size()
+        + name.fbe_size()
+        + auth.fbe_size()
+        ;
+    return fbe_result;
+}
+
+size_t FieldModel<::proto::LoginData>::fbe_extra() const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4) > _buffer.size()))
+        return 0;
+
+    _buffer.shift(fbe_struct_offset);
+
+    size_t fbe_result = fbe_body()
+        + id.fbe_extra()
+        + mask.fbe_extra()
+        + reply.fbe_extra()
+        + name.fbe_extra()
+        + auth.fbe_extra()
+        ;
+
+    _buffer.unshift(fbe_struct_offset);
+
+    return fbe_result;
+}
+
+bool FieldModel<::proto::LoginData>::verify(bool fbe_verify_type) const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return true;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4 + 4) > _buffer.size()))
+        return false;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset));
+    if (fbe_struct_size < (4 + 4))
+        return false;
+
+    uint32_t fbe_struct_type = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset + 4));
+    if (fbe_verify_type && (fbe_struct_type != fbe_type()))
+        return false;
+
+    _buffer.shift(fbe_struct_offset);
+    bool fbe_result = verify_fields(fbe_struct_size);
+    _buffer.unshift(fbe_struct_offset);
+    return fbe_result;
+}
+
+bool FieldModel<::proto::LoginData>::verify_fields(size_t fbe_struct_size) const noexcept
+{
+    size_t fbe_current_size = 4 + 4;
+
+    if ((fbe_current_size + id.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!id.verify())
+        return false;
+    fbe_current_size += id.fbe_size();
+
+    if ((fbe_current_size + mask.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!mask.verify())
+        return false;
+    fbe_current_size += mask.fbe_size();
+
+    if ((fbe_current_size + reply.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!reply.verify())
+        return false;
+    fbe_current_size += reply.fbe_size();
+
+    if ((fbe_current_size + name.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!name.verify())
+        return false;
+    fbe_current_size += name.fbe_size();
+
+    if ((fbe_current_size + auth.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!auth.verify())
+        return false;
+    fbe_current_size += auth.fbe_size();
+
+    return true;
+}
+
+size_t FieldModel<::proto::LoginData>::get_begin() const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    assert(((fbe_struct_offset > 0) && ((_buffer.offset() + fbe_struct_offset + 4 + 4) <= _buffer.size())) && "Model is broken!");
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4 + 4) > _buffer.size()))
+        return 0;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset));
+    assert((fbe_struct_size >= (4 + 4)) && "Model is broken!");
+    if (fbe_struct_size < (4 + 4))
+        return 0;
+
+    _buffer.shift(fbe_struct_offset);
+    return fbe_struct_offset;
+}
+
+void FieldModel<::proto::LoginData>::get_end(size_t fbe_begin) const noexcept
+{
+    _buffer.unshift(fbe_begin);
+}
+
+void FieldModel<::proto::LoginData>::get(::proto::LoginData& fbe_value) const noexcept
+{
+    size_t fbe_begin = get_begin();
+    if (fbe_begin == 0)
+        return;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset()));
+    get_fields(fbe_value, fbe_struct_size);
+    get_end(fbe_begin);
+}
+
+void FieldModel<::proto::LoginData>::get_fields(::proto::LoginData& fbe_value, size_t fbe_struct_size) const noexcept
+{
+    size_t fbe_current_size = 4 + 4;
+
+    if ((fbe_current_size + id.fbe_size()) <= fbe_struct_size)
+        id.get(fbe_value.id, FBE::uuid_t::sequential());
+    else
+        fbe_value.id = FBE::uuid_t::sequential();
+    fbe_current_size += id.fbe_size();
+
+    if ((fbe_current_size + mask.fbe_size()) <= fbe_struct_size)
+        mask.get(fbe_value.mask);
+    else
+        fbe_value.mask = (int32_t)0ll;
+    fbe_current_size += mask.fbe_size();
+
+    if ((fbe_current_size + reply.fbe_size()) <= fbe_struct_size)
+        reply.get(fbe_value.reply);
+    else
+        fbe_value.reply = false;
+    fbe_current_size += reply.fbe_size();
+
+    if ((fbe_current_size + name.fbe_size()) <= fbe_struct_size)
+        name.get(fbe_value.name);
+    else
+        fbe_value.name = "";
+    fbe_current_size += name.fbe_size();
+
+    if ((fbe_current_size + auth.fbe_size()) <= fbe_struct_size)
+        auth.get(fbe_value.auth);
+    else
+        fbe_value.auth = "";
+    fbe_current_size += auth.fbe_size();
+}
+
+size_t FieldModel<::proto::LoginData>::set_begin()
+{
+    assert(((_buffer.offset() + fbe_offset() + fbe_size()) <= _buffer.size()) && "Model is broken!");
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_size = (uint32_t)fbe_body();
+    uint32_t fbe_struct_offset = (uint32_t)(_buffer.allocate(fbe_struct_size) - _buffer.offset());
+    assert(((fbe_struct_offset > 0) && ((_buffer.offset() + fbe_struct_offset + fbe_struct_size) <= _buffer.size())) && "Model is broken!");
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + fbe_struct_size) > _buffer.size()))
+        return 0;
+
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset())) = fbe_struct_offset;
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset)) = fbe_struct_size;
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset + 4)) = (uint32_t)fbe_type();
+
+    _buffer.shift(fbe_struct_offset);
+    return fbe_struct_offset;
+}
+
+void FieldModel<::proto::LoginData>::set_end(size_t fbe_begin)
+{
+    _buffer.unshift(fbe_begin);
+}
+
+void FieldModel<::proto::LoginData>::set(const ::proto::LoginData& fbe_value) noexcept
+{
+    size_t fbe_begin = set_begin();
+    if (fbe_begin == 0)
+        return;
+
+    set_fields(fbe_value);
+    set_end(fbe_begin);
+}
+
+void FieldModel<::proto::LoginData>::set_fields(const ::proto::LoginData& fbe_value) noexcept
+{
+    id.set(fbe_value.id);
+    mask.set(fbe_value.mask);
+    reply.set(fbe_value.reply);
+    name.set(fbe_value.name);
+    auth.set(fbe_value.auth);
+}
+
+namespace proto {
+
+bool LoginDataModel::verify()
+{
+    if ((this->buffer().offset() + model.fbe_offset() - 4) > this->buffer().size())
+        return false;
+
+    uint32_t fbe_full_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4));
+    if (fbe_full_size < model.fbe_size())
+        return false;
+
+    return model.verify();
+}
+
+size_t LoginDataModel::create_begin()
+{
+    size_t fbe_begin = this->buffer().allocate(4 + model.fbe_size());
+    return fbe_begin;
+}
+
+size_t LoginDataModel::create_end(size_t fbe_begin)
+{
+    size_t fbe_end = this->buffer().size();
+    uint32_t fbe_full_size = (uint32_t)(fbe_end - fbe_begin);
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4)) = fbe_full_size;
+    return fbe_full_size;
+}
+
+size_t LoginDataModel::serialize(const ::proto::LoginData& value)
+{
+    size_t fbe_begin = create_begin();
+    model.set(value);
+    size_t fbe_full_size = create_end(fbe_begin);
+    return fbe_full_size;
+}
+
+size_t LoginDataModel::deserialize(::proto::LoginData& value) const noexcept
+{
+    if ((this->buffer().offset() + model.fbe_offset() - 4) > this->buffer().size())
+        return 0;
+
+    uint32_t fbe_full_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4));
+    assert((fbe_full_size >= model.fbe_size()) && "Model is broken!");
+    if (fbe_full_size < model.fbe_size())
+        return 0;
+
+    model.get(value);
+    return fbe_full_size;
+}
+
+} // namespace proto
+
+FieldModel<::proto::ApplyData>::FieldModel(FBEBuffer& buffer, size_t offset) noexcept : _buffer(buffer), _offset(offset)
+    , id(buffer, 4 + 4)
+    , mask(buffer, id.fbe_offset() + id.fbe_size())
+    , reply(buffer, mask.fbe_offset() + mask.fbe_size())
+    , flag(buffer, reply.fbe_offset() + reply.fbe_size())
+    , nick(buffer, flag.fbe_offset() + flag.fbe_size())
+    , host(buffer, nick.fbe_offset() + nick.fbe_size())
+    , port(buffer, host.fbe_offset() + host.fbe_size())
+    , fingerprint(buffer, port.fbe_offset() + port.fbe_size())
+{}
+
+size_t FieldModel<::proto::ApplyData>::fbe_body() const noexcept
+{
+    size_t fbe_result = 4 + 4
+        + id.fbe_size()
+        + mask.fbe_size()
+        + reply.fbe_size()
+        + flag.fbe_size()
+        + nick.fbe_size()
+        + host.fbe_size()
+        + port.fbe_size()
+        + fingerprint.fbe_size()
+        ;
+    return fbe_result;
+}
+
+size_t FieldModel<::proto::ApplyData>::fbe_extra() const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4) > _buffer.size()))
+        return 0;
+
+    _buffer.shift(fbe_struct_offset);
+
+    size_t fbe_result = fbe_body()
+        + id.fbe_extra()
+        + mask.fbe_extra()
+        + reply.fbe_extra()
+        + flag.fbe_extra()
+        + nick.fbe_extra()
+        + host.fbe_extra()
+        + port.fbe_extra()
+        + fingerprint.fbe_extra()
+        ;
+
+    _buffer.unshift(fbe_struct_offset);
+
+    return fbe_result;
+}
+
+bool FieldModel<::proto::ApplyData>::verify(bool fbe_verify_type) const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return true;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4 + 4) > _buffer.size()))
+        return false;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset));
+    if (fbe_struct_size < (4 + 4))
+        return false;
+
+    uint32_t fbe_struct_type = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset + 4));
+    if (fbe_verify_type && (fbe_struct_type != fbe_type()))
+        return false;
+
+    _buffer.shift(fbe_struct_offset);
+    bool fbe_result = verify_fields(fbe_struct_size);
+    _buffer.unshift(fbe_struct_offset);
+    return fbe_result;
+}
+
+bool FieldModel<::proto::ApplyData>::verify_fields(size_t fbe_struct_size) const noexcept
+{
+    size_t fbe_current_size = 4 + 4;
+
+    if ((fbe_current_size + id.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!id.verify())
+        return false;
+    fbe_current_size += id.fbe_size();
+
+    if ((fbe_current_size + mask.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!mask.verify())
+        return false;
+    fbe_current_size += mask.fbe_size();
+
+    if ((fbe_current_size + reply.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!reply.verify())
+        return false;
+    fbe_current_size += reply.fbe_size();
+
+    if ((fbe_current_size + flag.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!flag.verify())
+        return false;
+    fbe_current_size += flag.fbe_size();
+
+    if ((fbe_current_size + nick.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!nick.verify())
+        return false;
+    fbe_current_size += nick.fbe_size();
+
+    if ((fbe_current_size + host.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!host.verify())
+        return false;
+    fbe_current_size += host.fbe_size();
+
+    if ((fbe_current_size + port.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!port.verify())
+        return false;
+    fbe_current_size += port.fbe_size();
+
+    if ((fbe_current_size + fingerprint.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!fingerprint.verify())
+        return false;
+    fbe_current_size += fingerprint.fbe_size();
+
+    return true;
+}
+
+size_t FieldModel<::proto::ApplyData>::get_begin() const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    assert(((fbe_struct_offset > 0) && ((_buffer.offset() + fbe_struct_offset + 4 + 4) <= _buffer.size())) && "Model is broken!");
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4 + 4) > _buffer.size()))
+        return 0;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset));
+    assert((fbe_struct_size >= (4 + 4)) && "Model is broken!");
+    if (fbe_struct_size < (4 + 4))
+        return 0;
+
+    _buffer.shift(fbe_struct_offset);
+    return fbe_struct_offset;
+}
+
+void FieldModel<::proto::ApplyData>::get_end(size_t fbe_begin) const noexcept
+{
+    _buffer.unshift(fbe_begin);
+}
+
+void FieldModel<::proto::ApplyData>::get(::proto::ApplyData& fbe_value) const noexcept
+{
+    size_t fbe_begin = get_begin();
+    if (fbe_begin == 0)
+        return;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset()));
+    get_fields(fbe_value, fbe_struct_size);
+    get_end(fbe_begin);
+}
+
+void FieldModel<::proto::ApplyData>::get_fields(::proto::ApplyData& fbe_value, size_t fbe_struct_size) const noexcept
+{
+    size_t fbe_current_size = 4 + 4;
+
+    if ((fbe_current_size + id.fbe_size()) <= fbe_struct_size)
+        id.get(fbe_value.id, FBE::uuid_t::sequential());
+    else
+        fbe_value.id = FBE::uuid_t::sequential();
+    fbe_current_size += id.fbe_size();
+
+    if ((fbe_current_size + mask.fbe_size()) <= fbe_struct_size)
+        mask.get(fbe_value.mask);
+    else
+        fbe_value.mask = (int32_t)0ll;
+    fbe_current_size += mask.fbe_size();
+
+    if ((fbe_current_size + reply.fbe_size()) <= fbe_struct_size)
+        reply.get(fbe_value.reply);
+    else
+        fbe_value.reply = false;
+    fbe_current_size += reply.fbe_size();
+
+    if ((fbe_current_size + flag.fbe_size()) <= fbe_struct_size)
+        flag.get(fbe_value.flag);
+    else
+        fbe_value.flag = (int64_t)0ll;
+    fbe_current_size += flag.fbe_size();
+
+    if ((fbe_current_size + nick.fbe_size()) <= fbe_struct_size)
+        nick.get(fbe_value.nick);
+    else
+        fbe_value.nick = "";
+    fbe_current_size += nick.fbe_size();
+
+    if ((fbe_current_size + host.fbe_size()) <= fbe_struct_size)
+        host.get(fbe_value.host);
+    else
+        fbe_value.host = "";
+    fbe_current_size += host.fbe_size();
+
+    if ((fbe_current_size + port.fbe_size()) <= fbe_struct_size)
+        port.get(fbe_value.port);
+    else
+        fbe_value.port = (int64_t)0ll;
+    fbe_current_size += port.fbe_size();
+
+    if ((fbe_current_size + fingerprint.fbe_size()) <= fbe_struct_size)
+        fingerprint.get(fbe_value.fingerprint);
+    else
+        fbe_value.fingerprint = "";
+    fbe_current_size += fingerprint.fbe_size();
+}
+
+size_t FieldModel<::proto::ApplyData>::set_begin()
+{
+    assert(((_buffer.offset() + fbe_offset() + fbe_size()) <= _buffer.size()) && "Model is broken!");
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_size = (uint32_t)fbe_body();
+    uint32_t fbe_struct_offset = (uint32_t)(_buffer.allocate(fbe_struct_size) - _buffer.offset());
+    assert(((fbe_struct_offset > 0) && ((_buffer.offset() + fbe_struct_offset + fbe_struct_size) <= _buffer.size())) && "Model is broken!");
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + fbe_struct_size) > _buffer.size()))
+        return 0;
+
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset())) = fbe_struct_offset;
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset)) = fbe_struct_size;
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset + 4)) = (uint32_t)fbe_type();
+
+    _buffer.shift(fbe_struct_offset);
+    return fbe_struct_offset;
+}
+
+void FieldModel<::proto::ApplyData>::set_end(size_t fbe_begin)
+{
+    _buffer.unshift(fbe_begin);
+}
+
+void FieldModel<::proto::ApplyData>::set(const ::proto::ApplyData& fbe_value) noexcept
+{
+    size_t fbe_begin = set_begin();
+    if (fbe_begin == 0)
+        return;
+
+    set_fields(fbe_value);
+    set_end(fbe_begin);
+}
+
+void FieldModel<::proto::ApplyData>::set_fields(const ::proto::ApplyData& fbe_value) noexcept
+{
+    id.set(fbe_value.id);
+    mask.set(fbe_value.mask);
+    reply.set(fbe_value.reply);
+    flag.set(fbe_value.flag);
+    nick.set(fbe_value.nick);
+    host.set(fbe_value.host);
+    port.set(fbe_value.port);
+    fingerprint.set(fbe_value.fingerprint);
+}
+
+namespace proto {
+
+bool ApplyDataModel::verify()
+{
+    if ((this->buffer().offset() + model.fbe_offset() - 4) > this->buffer().size())
+        return false;
+
+    uint32_t fbe_full_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4));
+    if (fbe_full_size < model.fbe_size())
+        return false;
+
+    return model.verify();
+}
+
+size_t ApplyDataModel::create_begin()
+{
+    size_t fbe_begin = this->buffer().allocate(4 + model.fbe_size());
+    return fbe_begin;
+}
+
+size_t ApplyDataModel::create_end(size_t fbe_begin)
+{
+    size_t fbe_end = this->buffer().size();
+    uint32_t fbe_full_size = (uint32_t)(fbe_end - fbe_begin);
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4)) = fbe_full_size;
+    return fbe_full_size;
+}
+
+size_t ApplyDataModel::serialize(const ::proto::ApplyData& value)
+{
+    size_t fbe_begin = create_begin();
+    model.set(value);
+    size_t fbe_full_size = create_end(fbe_begin);
+    return fbe_full_size;
+}
+
+size_t ApplyDataModel::deserialize(::proto::ApplyData& value) const noexcept
+{
+    if ((this->buffer().offset() + model.fbe_offset() - 4) > this->buffer().size())
+        return 0;
+
+    uint32_t fbe_full_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4));
+    assert((fbe_full_size >= model.fbe_size()) && "Model is broken!");
+    if (fbe_full_size < model.fbe_size())
+        return 0;
+
+    model.get(value);
+    return fbe_full_size;
+}
+
+} // namespace proto
+
+FieldModel<::proto::TransData>::FieldModel(FBEBuffer& buffer, size_t offset) noexcept : _buffer(buffer), _offset(offset)
+    , id(buffer, 4 + 4)
+    , mask(buffer, id.fbe_offset() + id.fbe_size())
+    , reply(buffer, mask.fbe_offset() + mask.fbe_size())
+    , job(buffer, reply.fbe_offset() + reply.fbe_size())
+    , names(buffer, job.fbe_offset() + job.fbe_size())
+    , endpoint(buffer, names.fbe_offset() + names.fbe_size())
+    , flag(buffer, endpoint.fbe_offset() + endpoint.fbe_size())
+    , size(buffer, flag.fbe_offset() + flag.fbe_size())
+{}
+
+size_t FieldModel<::proto::TransData>::fbe_body() const noexcept
+{
+    size_t fbe_result = 4 + 4
+        + id.fbe_size()
+        + mask.fbe_size()
+        + reply.fbe_size()
+        + job.fbe_size()
+        + names.fbe_size()
+        + endpoint.fbe_size()
+        + flag.fbe_size()
+        + size.fbe_size()
+        ;
+    return fbe_result;
+}
+
+size_t FieldModel<::proto::TransData>::fbe_extra() const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4) > _buffer.size()))
+        return 0;
+
+    _buffer.shift(fbe_struct_offset);
+
+    size_t fbe_result = fbe_body()
+        + id.fbe_extra()
+        + mask.fbe_extra()
+        + reply.fbe_extra()
+        + job.fbe_extra()
+        + names.fbe_extra()
+        + endpoint.fbe_extra()
+        + flag.fbe_extra()
+        + size.fbe_extra()
+        ;
+
+    _buffer.unshift(fbe_struct_offset);
+
+    return fbe_result;
+}
+
+bool FieldModel<::proto::TransData>::verify(bool fbe_verify_type) const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return true;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4 + 4) > _buffer.size()))
+        return false;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset));
+    if (fbe_struct_size < (4 + 4))
+        return false;
+
+    uint32_t fbe_struct_type = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset + 4));
+    if (fbe_verify_type && (fbe_struct_type != fbe_type()))
+        return false;
+
+    _buffer.shift(fbe_struct_offset);
+    bool fbe_result = verify_fields(fbe_struct_size);
+    _buffer.unshift(fbe_struct_offset);
+    return fbe_result;
+}
+
+bool FieldModel<::proto::TransData>::verify_fields(size_t fbe_struct_size) const noexcept
+{
+    size_t fbe_current_size = 4 + 4;
+
+    if ((fbe_current_size + id.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!id.verify())
+        return false;
+    fbe_current_size += id.fbe_size();
+
+    if ((fbe_current_size + mask.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!mask.verify())
+        return false;
+    fbe_current_size += mask.fbe_size();
+
+    if ((fbe_current_size + reply.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!reply.verify())
+        return false;
+    fbe_current_size += reply.fbe_size();
+
+    if ((fbe_current_size + job.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!job.verify())
+        return false;
+    fbe_current_size += job.fbe_size();
+
+    if ((fbe_current_size + names.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!names.verify())
+        return false;
+    fbe_current_size += names.fbe_size();
+
+    if ((fbe_current_size + endpoint.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!endpoint.verify())
+        return false;
+    fbe_current_size += endpoint.fbe_size();
+
+    if ((fbe_current_size + flag.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!flag.verify())
+        return false;
+    fbe_current_size += flag.fbe_size();
+
+    if ((fbe_current_size + size.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!size.verify())
+        return false;
+    fbe_current_size += size.fbe_size();
+
+    return true;
+}
+
+size_t FieldModel<::proto::TransData>::get_begin() const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    assert(((fbe_struct_offset > 0) && ((_buffer.offset() + fbe_struct_offset + 4 + 4) <= _buffer.size())) && "Model is broken!");
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4 + 4) > _buffer.size()))
+        return 0;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset));
+    assert((fbe_struct_size >= (4 + 4)) && "Model is broken!");
+    if (fbe_struct_size < (4 + 4))
+        return 0;
+
+    _buffer.shift(fbe_struct_offset);
+    return fbe_struct_offset;
+}
+
+void FieldModel<::proto::TransData>::get_end(size_t fbe_begin) const noexcept
+{
+    _buffer.unshift(fbe_begin);
+}
+
+void FieldModel<::proto::TransData>::get(::proto::TransData& fbe_value) const noexcept
+{
+    size_t fbe_begin = get_begin();
+    if (fbe_begin == 0)
+        return;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset()));
+    get_fields(fbe_value, fbe_struct_size);
+    get_end(fbe_begin);
+}
+
+void FieldModel<::proto::TransData>::get_fields(::proto::TransData& fbe_value, size_t fbe_struct_size) const noexcept
+{
+    size_t fbe_current_size = 4 + 4;
+
+    if ((fbe_current_size + id.fbe_size()) <= fbe_struct_size)
+        id.get(fbe_value.id, FBE::uuid_t::sequential());
+    else
+        fbe_value.id = FBE::uuid_t::sequential();
+    fbe_current_size += id.fbe_size();
+
+    if ((fbe_current_size + mask.fbe_size()) <= fbe_struct_size)
+        mask.get(fbe_value.mask);
+    else
+        fbe_value.mask = (int32_t)0ll;
+    fbe_current_size += mask.fbe_size();
+
+    if ((fbe_current_size + reply.fbe_size()) <= fbe_struct_size)
+        reply.get(fbe_value.reply);
+    else
+        fbe_value.reply = false;
+    fbe_current_size += reply.fbe_size();
+
+    if ((fbe_current_size + job.fbe_size()) <= fbe_struct_size)
+        job.get(fbe_value.job);
+    else
+        fbe_value.job = "";
+    fbe_current_size += job.fbe_size();
+
+    if ((fbe_current_size + names.fbe_size()) <= fbe_struct_size)
+        names.get(fbe_value.names);
+    else
+        fbe_value.names.clear();
+    fbe_current_size += names.fbe_size();
+
+    if ((fbe_current_size + endpoint.fbe_size()) <= fbe_struct_size)
+        endpoint.get(fbe_value.endpoint);
+    else
+        fbe_value.endpoint = "";
+    fbe_current_size += endpoint.fbe_size();
+
+    if ((fbe_current_size + flag.fbe_size()) <= fbe_struct_size)
+        flag.get(fbe_value.flag);
+    else
+        fbe_value.flag = false;
+    fbe_current_size += flag.fbe_size();
+
+    if ((fbe_current_size + size.fbe_size()) <= fbe_struct_size)
+        size.get(fbe_value.size);
+    else
+        fbe_value.size = (int64_t)0ll;
+    fbe_current_size += size.fbe_size();
+}
+
+size_t FieldModel<::proto::TransData>::set_begin()
+{
+    assert(((_buffer.offset() + fbe_offset() + fbe_size()) <= _buffer.size()) && "Model is broken!");
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_size = (uint32_t)fbe_body();
+    uint32_t fbe_struct_offset = (uint32_t)(_buffer.allocate(fbe_struct_size) - _buffer.offset());
+    assert(((fbe_struct_offset > 0) && ((_buffer.offset() + fbe_struct_offset + fbe_struct_size) <= _buffer.size())) && "Model is broken!");
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + fbe_struct_size) > _buffer.size()))
+        return 0;
+
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset())) = fbe_struct_offset;
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset)) = fbe_struct_size;
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset + 4)) = (uint32_t)fbe_type();
+
+    _buffer.shift(fbe_struct_offset);
+    return fbe_struct_offset;
+}
+
+void FieldModel<::proto::TransData>::set_end(size_t fbe_begin)
+{
+    _buffer.unshift(fbe_begin);
+}
+
+void FieldModel<::proto::TransData>::set(const ::proto::TransData& fbe_value) noexcept
+{
+    size_t fbe_begin = set_begin();
+    if (fbe_begin == 0)
+        return;
+
+    set_fields(fbe_value);
+    set_end(fbe_begin);
+}
+
+void FieldModel<::proto::TransData>::set_fields(const ::proto::TransData& fbe_value) noexcept
+{
+    id.set(fbe_value.id);
+    mask.set(fbe_value.mask);
+    reply.set(fbe_value.reply);
+    job.set(fbe_value.job);
+    names.set(fbe_value.names);
+    endpoint.set(fbe_value.endpoint);
+    flag.set(fbe_value.flag);
+    size.set(fbe_value.size);
+}
+
+namespace proto {
+
+bool TransDataModel::verify()
+{
+    if ((this->buffer().offset() + model.fbe_offset() - 4) > this->buffer().size())
+        return false;
+
+    uint32_t fbe_full_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4));
+    if (fbe_full_size < model.fbe_size())
+        return false;
+
+    return model.verify();
+}
+
+size_t TransDataModel::create_begin()
+{
+    size_t fbe_begin = this->buffer().allocate(4 + model.fbe_size());
+    return fbe_begin;
+}
+
+size_t TransDataModel::create_end(size_t fbe_begin)
+{
+    size_t fbe_end = this->buffer().size();
+    uint32_t fbe_full_size = (uint32_t)(fbe_end - fbe_begin);
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4)) = fbe_full_size;
+    return fbe_full_size;
+}
+
+size_t TransDataModel::serialize(const ::proto::TransData& value)
+{
+    size_t fbe_begin = create_begin();
+    model.set(value);
+    size_t fbe_full_size = create_end(fbe_begin);
+    return fbe_full_size;
+}
+
+size_t TransDataModel::deserialize(::proto::TransData& value) const noexcept
+{
+    if ((this->buffer().offset() + model.fbe_offset() - 4) > this->buffer().size())
+        return 0;
+
+    uint32_t fbe_full_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4));
+    assert((fbe_full_size >= model.fbe_size()) && "Model is broken!");
+    if (fbe_full_size < model.fbe_size())
+        return 0;
+
+    model.get(value);
+    return fbe_full_size;
+}
+
+} // namespace proto
+
+FieldModel<::proto::CancelData>::FieldModel(FBEBuffer& buffer, size_t offset) noexcept : _buffer(buffer), _offset(offset)
+    , id(buffer, 4 + 4)
+    , mask(buffer, id.fbe_offset() + id.fbe_size())
+    , reply(buffer, mask.fbe_offset() + mask.fbe_size())
+    , job(buffer, reply.fbe_offset() + reply.fbe_size())
+    , name(buffer, job.fbe_offset() + job.fbe_size())
+    , reason(buffer, name.fbe_offset() + name.fbe_size())
+{}
+
+size_t FieldModel<::proto::CancelData>::fbe_body() const noexcept
+{
+    size_t fbe_result = 4 + 4
+        + id.fbe_size()
+        + mask.fbe_size()
+        + reply.fbe_size()
+        + job.fbe_size()
+        + name.fbe_size()
+        + reason.fbe_size()
+        ;
+    return fbe_result;
+}
+
+size_t FieldModel<::proto::CancelData>::fbe_extra() const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4) > _buffer.size()))
+        return 0;
+
+    _buffer.shift(fbe_struct_offset);
+
+    size_t fbe_result = fbe_body()
+        + id.fbe_extra()
+        + mask.fbe_extra()
+        + reply.fbe_extra()
+        + job.fbe_extra()
+        + name.fbe_extra()
+        + reason.fbe_extra()
+        ;
+
+    _buffer.unshift(fbe_struct_offset);
+
+    return fbe_result;
+}
+
+bool FieldModel<::proto::CancelData>::verify(bool fbe_verify_type) const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return true;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4 + 4) > _buffer.size()))
+        return false;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset));
+    if (fbe_struct_size < (4 + 4))
+        return false;
+
+    uint32_t fbe_struct_type = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset + 4));
+    if (fbe_verify_type && (fbe_struct_type != fbe_type()))
+        return false;
+
+    _buffer.shift(fbe_struct_offset);
+    bool fbe_result = verify_fields(fbe_struct_size);
+    _buffer.unshift(fbe_struct_offset);
+    return fbe_result;
+}
+
+bool FieldModel<::proto::CancelData>::verify_fields(size_t fbe_struct_size) const noexcept
+{
+    size_t fbe_current_size = 4 + 4;
+
+    if ((fbe_current_size + id.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!id.verify())
+        return false;
+    fbe_current_size += id.fbe_size();
+
+    if ((fbe_current_size + mask.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!mask.verify())
+        return false;
+    fbe_current_size += mask.fbe_size();
+
+    if ((fbe_current_size + reply.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!reply.verify())
+        return false;
+    fbe_current_size += reply.fbe_size();
+
+    if ((fbe_current_size + job.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!job.verify())
+        return false;
+    fbe_current_size += job.fbe_size();
+
+    if ((fbe_current_size + name.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!name.verify())
+        return false;
+    fbe_current_size += name.fbe_size();
+
+    if ((fbe_current_size + reason.fbe_size()) > fbe_struct_size)
+        return true;
+    if (!reason.verify())
+        return false;
+    fbe_current_size += reason.fbe_size();
+
+    return true;
+}
+
+size_t FieldModel<::proto::CancelData>::get_begin() const noexcept
+{
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_offset = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset()));
+    assert(((fbe_struct_offset > 0) && ((_buffer.offset() + fbe_struct_offset + 4 + 4) <= _buffer.size())) && "Model is broken!");
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + 4 + 4) > _buffer.size()))
+        return 0;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset));
+    assert((fbe_struct_size >= (4 + 4)) && "Model is broken!");
+    if (fbe_struct_size < (4 + 4))
+        return 0;
+
+    _buffer.shift(fbe_struct_offset);
+    return fbe_struct_offset;
+}
+
+void FieldModel<::proto::CancelData>::get_end(size_t fbe_begin) const noexcept
+{
+    _buffer.unshift(fbe_begin);
+}
+
+void FieldModel<::proto::CancelData>::get(::proto::CancelData& fbe_value) const noexcept
+{
+    size_t fbe_begin = get_begin();
+    if (fbe_begin == 0)
+        return;
+
+    uint32_t fbe_struct_size = *((const uint32_t*)(_buffer.data() + _buffer.offset()));
+    get_fields(fbe_value, fbe_struct_size);
+    get_end(fbe_begin);
+}
+
+void FieldModel<::proto::CancelData>::get_fields(::proto::CancelData& fbe_value, size_t fbe_struct_size) const noexcept
+{
+    size_t fbe_current_size = 4 + 4;
+
+    if ((fbe_current_size + id.fbe_size()) <= fbe_struct_size)
+        id.get(fbe_value.id, FBE::uuid_t::sequential());
+    else
+        fbe_value.id = FBE::uuid_t::sequential();
+    fbe_current_size += id.fbe_size();
+
+    if ((fbe_current_size + mask.fbe_size()) <= fbe_struct_size)
+        mask.get(fbe_value.mask);
+    else
+        fbe_value.mask = (int32_t)0ll;
+    fbe_current_size += mask.fbe_size();
+
+    if ((fbe_current_size + reply.fbe_size()) <= fbe_struct_size)
+        reply.get(fbe_value.reply);
+    else
+        fbe_value.reply = false;
+    fbe_current_size += reply.fbe_size();
+
+    if ((fbe_current_size + job.fbe_size()) <= fbe_struct_size)
+        job.get(fbe_value.job);
+    else
+        fbe_value.job = "";
+    fbe_current_size += job.fbe_size();
+
+    if ((fbe_current_size + name.fbe_size()) <= fbe_struct_size)
+        name.get(fbe_value.name);
+    else
+        fbe_value.name = "";
+    fbe_current_size += name.fbe_size();
+
+    if ((fbe_current_size + reason.fbe_size()) <= fbe_struct_size)
+        reason.get(fbe_value.reason);
+    else
+        fbe_value.reason = "";
+    fbe_current_size += reason.fbe_size();
+}
+
+size_t FieldModel<::proto::CancelData>::set_begin()
+{
+    assert(((_buffer.offset() + fbe_offset() + fbe_size()) <= _buffer.size()) && "Model is broken!");
+    if ((_buffer.offset() + fbe_offset() + fbe_size()) > _buffer.size())
+        return 0;
+
+    uint32_t fbe_struct_size = (uint32_t)fbe_body();
+    uint32_t fbe_struct_offset = (uint32_t)(_buffer.allocate(fbe_struct_size) - _buffer.offset());
+    assert(((fbe_struct_offset > 0) && ((_buffer.offset() + fbe_struct_offset + fbe_struct_size) <= _buffer.size())) && "Model is broken!");
+    if ((fbe_struct_offset == 0) || ((_buffer.offset() + fbe_struct_offset + fbe_struct_size) > _buffer.size()))
+        return 0;
+
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_offset())) = fbe_struct_offset;
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset)) = fbe_struct_size;
+    *((uint32_t*)(_buffer.data() + _buffer.offset() + fbe_struct_offset + 4)) = (uint32_t)fbe_type();
+
+    _buffer.shift(fbe_struct_offset);
+    return fbe_struct_offset;
+}
+
+void FieldModel<::proto::CancelData>::set_end(size_t fbe_begin)
+{
+    _buffer.unshift(fbe_begin);
+}
+
+void FieldModel<::proto::CancelData>::set(const ::proto::CancelData& fbe_value) noexcept
+{
+    size_t fbe_begin = set_begin();
+    if (fbe_begin == 0)
+        return;
+
+    set_fields(fbe_value);
+    set_end(fbe_begin);
+}
+
+void FieldModel<::proto::CancelData>::set_fields(const ::proto::CancelData& fbe_value) noexcept
+{
+    id.set(fbe_value.id);
+    mask.set(fbe_value.mask);
+    reply.set(fbe_value.reply);
+    job.set(fbe_value.job);
+    name.set(fbe_value.name);
+    reason.set(fbe_value.reason);
+}
+
+namespace proto {
+
+bool CancelDataModel::verify()
+{
+    if ((this->buffer().offset() + model.fbe_offset() - 4) > this->buffer().size())
+        return false;
+
+    uint32_t fbe_full_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4));
+    if (fbe_full_size < model.fbe_size())
+        return false;
+
+    return model.verify();
+}
+
+size_t CancelDataModel::create_begin()
+{
+    size_t fbe_begin = this->buffer().allocate(4 + model.fbe_size());
+    return fbe_begin;
+}
+
+size_t CancelDataModel::create_end(size_t fbe_begin)
+{
+    size_t fbe_end = this->buffer().size();
+    uint32_t fbe_full_size = (uint32_t)(fbe_end - fbe_begin);
+    *((uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4)) = fbe_full_size;
+    return fbe_full_size;
+}
+
+size_t CancelDataModel::serialize(const ::proto::CancelData& value)
+{
+    size_t fbe_begin = create_begin();
+    model.set(value);
+    size_t fbe_full_size = create_end(fbe_begin);
+    return fbe_full_size;
+}
+
+size_t CancelDataModel::deserialize(::proto::CancelData& value) const noexcept
+{
+    if ((this->buffer().offset() + model.fbe_offset() - 4) > this->buffer().size())
+        return 0;
+
+    uint32_t fbe_full_size = *((const uint32_t*)(this->buffer().data() + this->buffer().offset() + model.fbe_offset() - 4));
+    assert((fbe_full_size >= model.fbe_size()) && "Model is broken!");
+    if (fbe_full_size < model.fbe_size())
+        return 0;
+
+    model.get(value);
+    return fbe_full_size;
+}
+
+} // namespace proto
+
 } // namespace FBE
@@ -392,4 +392,395 @@ public:
 
 } // namespace proto
 
+// Fast Binary Encoding ::proto::LoginData field model
+template <>
+class FieldModel<::proto::LoginData>
+{
+public:
+    FieldModel(FBEBuffer& buffer, size_t offset) noexcept;
+
+    // Get the field offset
+    size_t fbe_offset() const noexcept { return _offset; }
+    // Get the field size
+    size_t fbe_size() const noexcept { return 4; }
+    // Get the field body size
+    size_t fbe_body() const noexcept;
+    // Get the field extra size
+    size_t fbe_extra() const noexcept;
+    // Get the field type
+    static constexpr size_t fbe_type() noexcept { return 5; }
+
+    // Shift the current field offset
+    void fbe_shift(size_t size) noexcept { _offset += size; }
+    // Unshift the current field offset
+    void fbe_unshift(size_t size) noexcept { _offset -= size; }
+
+    // Check if the struct value is valid
+    bool verify(bool fbe_verify_type = true) const noexcept;
+    // Check if the struct fields are valid
+    bool verify_fields(size_t fbe_struct_size) const noexcept;
+
+    // Get the struct value (begin phase)
+    size_t get_begin() const noexcept;
+    // Get the struct value (end phase)
+    void get_end(size_t fbe_begin) const noexcept;
+
+    // Get the struct value
+    void get(::proto::LoginData& fbe_value) const noexcept;
+    // Get the struct fields values
+    void get_fields(::proto::LoginData& fbe_value, size_t fbe_struct_size) const noexcept;
+
+    // Set the struct value (begin phase)
+    size_t set_begin();
+    // Set the struct value (end phase)
+    void set_end(size_t fbe_begin);
+
+    // Set the struct value
+    void set(const ::proto::LoginData& fbe_value) noexcept;
+    // Set the struct fields values
+    void set_fields(const ::proto::LoginData& fbe_value) noexcept;
+
+private:
+    FBEBuffer& _buffer;
+    size_t _offset;
+
+public:
+    FieldModel<FBE::uuid_t> id;
+    FieldModel<int32_t> mask;
+    FieldModel<bool> reply;
+    FieldModel<std::string> name;
+    FieldModel<std::string> auth;
+};
+
+namespace proto {
+
+// Fast Binary Encoding LoginData model
+class LoginDataModel : public FBE::Model
+{
+public:
+    LoginDataModel() : model(this->buffer(), 4) {}
+    LoginDataModel(const std::shared_ptr<FBEBuffer>& buffer) : FBE::Model(buffer), model(this->buffer(), 4) {}
+
+    // Get the model size
+    size_t fbe_size() const noexcept { return model.fbe_size() + model.fbe_extra(); }
+    // Get the model type
+    static constexpr size_t fbe_type() noexcept { return FieldModel<::proto::LoginData>::fbe_type(); }
+
+    // Check if the struct value is valid
+    bool verify();
+
+    // Create a new model (begin phase)
+    size_t create_begin();
+    // Create a new model (end phase)
+    size_t create_end(size_t fbe_begin);
+
+    // Serialize the struct value
+    size_t serialize(const ::proto::LoginData& value);
+    // Deserialize the struct value
+    size_t deserialize(::proto::LoginData& value) const noexcept;
+
+    // Move to the next struct value
+    void next(size_t prev) noexcept { model.fbe_shift(prev); }
+
+public:
+    FieldModel<::proto::LoginData> model;
+};
+
+} // namespace proto
+
+// Fast Binary Encoding ::proto::ApplyData field model
+template <>
+class FieldModel<::proto::ApplyData>
+{
+public:
+    FieldModel(FBEBuffer& buffer, size_t offset) noexcept;
+
+    // Get the field offset
+    size_t fbe_offset() const noexcept { return _offset; }
+    // Get the field size
+    size_t fbe_size() const noexcept { return 4; }
+    // Get the field body size
+    size_t fbe_body() const noexcept;
+    // Get the field extra size
+    size_t fbe_extra() const noexcept;
+    // Get the field type
+    static constexpr size_t fbe_type() noexcept { return 6; }
+
+    // Shift the current field offset
+    void fbe_shift(size_t size) noexcept { _offset += size; }
+    // Unshift the current field offset
+    void fbe_unshift(size_t size) noexcept { _offset -= size; }
+
+    // Check if the struct value is valid
+    bool verify(bool fbe_verify_type = true) const noexcept;
+    // Check if the struct fields are valid
+    bool verify_fields(size_t fbe_struct_size) const noexcept;
+
+    // Get the struct value (begin phase)
+    size_t get_begin() const noexcept;
+    // Get the struct value (end phase)
+    void get_end(size_t fbe_begin) const noexcept;
+
+    // Get the struct value
+    void get(::proto::ApplyData& fbe_value) const noexcept;
+    // Get the struct fields values
+    void get_fields(::proto::ApplyData& fbe_value, size_t fbe_struct_size) const noexcept;
+
+    // Set the struct value (begin phase)
+    size_t set_begin();
+    // Set the struct value (end phase)
+    void set_end(size_t fbe_begin);
+
+    // Set the struct value
+    void set(const ::proto::ApplyData& fbe_value) noexcept;
+    // Set the struct fields values
+    void set_fields(const ::proto::ApplyData& fbe_value) noexcept;
+
+private:
+    FBEBuffer& _buffer;
+    size_t _offset;
+
+public:
+    FieldModel<FBE::uuid_t> id;
+    FieldModel<int32_t> mask;
+    FieldModel<bool> reply;
+    FieldModel<int64_t> flag;
+    FieldModel<std::string> nick;
+    FieldModel<std::string> host;
+    FieldModel<int64_t> port;
+    FieldModel<std::string> fingerprint;
+};
+
+namespace proto {
+
+// Fast Binary Encoding ApplyData model
+class ApplyDataModel : public FBE::Model
+{
+public:
+    ApplyDataModel() : model(this->buffer(), 4) {}
+    ApplyDataModel(const std::shared_ptr<FBEBuffer>& buffer) : FBE::Model(buffer), model(this->buffer(), 4) {}
+
+    // Get the model size
+    size_t fbe_size() const noexcept { return model.fbe_size() + model.fbe_extra(); }
+    // Get the model type
+    static constexpr size_t fbe_type() noexcept { return FieldModel<::proto::ApplyData>::fbe_type(); }
+
+    // Check if the struct value is valid
+    bool verify();
+
+    // Create a new model (begin phase)
+    size_t create_begin();
+    // Create a new model (end phase)
+    size_t create_end(size_t fbe_begin);
+
+    // Serialize the struct value
+    size_t serialize(const ::proto::ApplyData& value);
+    // Deserialize the struct value
+    size_t deserialize(::proto::ApplyData& value) const noexcept;
+
+    // Move to the next struct value
+    void next(size_t prev) noexcept { model.fbe_shift(prev); }
+
+public:
+    FieldModel<::proto::ApplyData> model;
+};
+
+} // namespace proto
+
+// Fast Binary Encoding ::proto::TransData field model
+template <>
+class FieldModel<::proto::TransData>
+{
+public:
+    FieldModel(FBEBuffer& buffer, size_t offset) noexcept;
+
+    // Get the field offset
+    size_t fbe_offset() const noexcept { return _offset; }
+    // Get the field size
+    size_t fbe_size() const noexcept { return 4; }
+    // Get the field body size
+    size_t fbe_body() const noexcept;
+    // Get the field extra size
+    size_t fbe_extra() const noexcept;
+    // Get the field type
+    static constexpr size_t fbe_type() noexcept { return 7; }
+
+    // Shift the current field offset
+    void fbe_shift(size_t size) noexcept { _offset += size; }
+    // Unshift the current field offset
+    void fbe_unshift(size_t size) noexcept { _offset -= size; }
+
+    // Check if the struct value is valid
+    bool verify(bool fbe_verify_type = true) const noexcept;
+    // Check if the struct fields are valid
+    bool verify_fields(size_t fbe_struct_size) const noexcept;
+
+    // Get the struct value (begin phase)
+    size_t get_begin() const noexcept;
+    // Get the struct value (end phase)
+    void get_end(size_t fbe_begin) const noexcept;
+
+    // Get the struct value
+    void get(::proto::TransData& fbe_value) const noexcept;
+    // Get the struct fields values
+    void get_fields(::proto::TransData& fbe_value, size_t fbe_struct_size) const noexcept;
+
+    // Set the struct value (begin phase)
+    size_t set_begin();
+    // Set the struct value (end phase)
+    void set_end(size_t fbe_begin);
+
+    // Set the struct value
+    void set(const ::proto::TransData& fbe_value) noexcept;
+    // Set the struct fields values
+    void set_fields(const ::proto::TransData& fbe_value) noexcept;
+
+private:
+    FBEBuffer& _buffer;
+    size_t _offset;
+
+public:
+    FieldModel<FBE::uuid_t> id;
+    FieldModel<int32_t> mask;
+    FieldModel<bool> reply;
+    FieldModel<std::string> job;
+    FieldModelVector<std::string> names;
+    FieldModel<std::string> endpoint;
+    FieldModel<bool> flag;
+    FieldModel<int64_t> size;
+};
+
+namespace proto {
+
+// Fast Binary Encoding TransData model
+class TransDataModel : public FBE::Model
+{
+public:
+    TransDataModel() : model(this->buffer(), 4) {}
+    TransDataModel(const std::shared_ptr<FBEBuffer>& buffer) : FBE::Model(buffer), model(this->buffer(), 4) {}
+
+    // Get the model size
+    size_t fbe_size() const noexcept { return model.fbe_size() + model.fbe_extra(); }
+    // Get the model type
+    static constexpr size_t fbe_type() noexcept { return FieldModel<::proto::TransData>::fbe_type(); }
+
+    // Check if the struct value is valid
+    bool verify();
+
+    // Create a new model (begin phase)
+    size_t create_begin();
+    // Create a new model (end phase)
+    size_t create_end(size_t fbe_begin);
+
+    // Serialize the struct value
+    size_t serialize(const ::proto::TransData& value);
+    // Deserialize the struct value
+    size_t deserialize(::proto::TransData& value) const noexcept;
+
+    // Move to the next struct value
+    void next(size_t prev) noexcept { model.fbe_shift(prev); }
+
+public:
+    FieldModel<::proto::TransData> model;
+};
+
+} // namespace proto
+
+// Fast Binary Encoding ::proto::CancelData field model
+template <>
+class FieldModel<::proto::CancelData>
+{
+public:
+    FieldModel(FBEBuffer& buffer, size_t offset) noexcept;
+
+    // Get the field offset
+    size_t fbe_offset() const noexcept { return _offset; }
+    // Get the field size
+    size_t fbe_size() const noexcept { return 4; }
+    // Get the field body size
+    size_t fbe_body() const noexcept;
+    // Get the field extra size
+    size_t fbe_extra() const noexcept;
+    // Get the field type
+    static constexpr size_t fbe_type() noexcept { return 8; }
+
+    // Shift the current field offset
+    void fbe_shift(size_t size) noexcept { _offset += size; }
+    // Unshift the current field offset
+    void fbe_unshift(size_t size) noexcept { _offset -= size; }
+
+    // Check if the struct value is valid
+    bool verify(bool fbe_verify_type = true) const noexcept;
+    // Check if the struct fields are valid
+    bool verify_fields(size_t fbe_struct_size) const noexcept;
+
+    // Get the struct value (begin phase)
+    size_t get_begin() const noexcept;
+    // Get the struct value (end phase)
+    void get_end(size_t fbe_begin) const noexcept;
+
+    // Get the struct value
+    void get(::proto::CancelData& fbe_value) const noexcept;
+    // Get the struct fields values
+    void get_fields(::proto::CancelData& fbe_value, size_t fbe_struct_size) const noexcept;
+
+    // Set the struct value (begin phase)
+    size_t set_begin();
+    // Set the struct value (end phase)
+    void set_end(size_t fbe_begin);
+
+    // Set the struct value
+    void set(const ::proto::CancelData& fbe_value) noexcept;
+    // Set the struct fields values
+    void set_fields(const ::proto::CancelData& fbe_value) noexcept;
+
+private:
+    FBEBuffer& _buffer;
+    size_t _offset;
+
+public:
+    FieldModel<FBE::uuid_t> id;
+    FieldModel<int32_t> mask;
+    FieldModel<bool> reply;
+    FieldModel<std::string> job;
+    FieldModel<std::string> name;
+    FieldModel<std::string> reason;
+};
+
+namespace proto {
+
+// Fast Binary Encoding CancelData model
+class CancelDataModel : public FBE::Model
+{
+public:
+    CancelDataModel() : model(this->buffer(), 4) {}
+    CancelDataModel(const std::shared_ptr<FBEBuffer>& buffer) : FBE::Model(buffer), model(this->buffer(), 4) {}
+
+    // Get the model size
+    size_t fbe_size() const noexcept { return model.fbe_size() + model.fbe_extra(); }
+    // Get the model type
+    static constexpr size_t fbe_type() noexcept { return FieldModel<::proto::CancelData>::fbe_type(); }
+
+    // Check if the struct value is valid
+    bool verify();
+
+    // Create a new model (begin phase)
+    size_t create_begin();
+    // Create a new model (end phase)
+    size_t create_end(size_t fbe_begin);
+
+    // Serialize the struct value
+    size_t serialize(const ::proto::CancelData& value);
+    // Deserialize the struct value
+    size_t deserialize(::proto::CancelData& value) const noexcept;
+
+    // Move to the next struct value
+    void next(size_t prev) noexcept { model.fbe_shift(prev); }
+
+public:
+    FieldModel<::proto::CancelData> model;
+};
+
+} // namespace proto
+
 } // namespace FBE
@@ -88,6 +88,78 @@ size_t Sender::send(const ::proto::DisconnectRequest& value)
     return this->send_serialized(serialized);
 }
 
+size_t Sender::send(const ::proto::LoginData& value)
+{
+    // Serialize the value into the FBE stream
+    size_t serialized = LoginDataModel.serialize(value);
+    assert((serialized > 0) && "proto::LoginData serialization failed!");
+    assert(LoginDataModel.verify() && "proto::LoginData validation failed!");
+
+    // Log the value
+    if (this->_logging)
+    {
+        std::string message = value.string();
+        this->onSendLog(message);
+    }
+
+    // Send the serialized value
+    return this->send_serialized(serialized);
+}
+
+size_t Sender::send(const ::proto::ApplyData& value)
+{
+    // Serialize the value into the FBE stream
+    size_t serialized = ApplyDataModel.serialize(value);
+    assert((serialized > 0) && "proto::ApplyData serialization failed!");
+    assert(ApplyDataModel.verify() && "proto::ApplyData validation failed!");
+
+    // Log the value
+    if (this->_logging)
+    {
+        std::string message = value.string();
+        this->onSendLog(message);
+    }
+
+    // Send the serialized value
+    return this->send_serialized(serialized);
+}
+
+size_t Sender::send(const ::proto::TransData& value)
+{
+    // Serialize the value into the FBE stream
+    size_t serialized = TransDataModel.serialize(value);
+    assert((serialized > 0) && "proto::TransData serialization failed!");
+    assert(TransDataModel.verify() && "proto::TransData validation failed!");
+
+    // Log the value
+    if (this->_logging)
+    {
+        std::string message = value.string();
+        this->onSendLog(message);
+    }
+
+    // Send the serialized value
+    return this->send_serialized(serialized);
+}
+
+size_t Sender::send(const ::proto::CancelData& value)
+{
+    // Serialize the value into the FBE stream
+    size_t serialized = CancelDataModel.serialize(value);
+    assert((serialized > 0) && "proto::CancelData serialization failed!");
+    assert(CancelDataModel.verify() && "proto::CancelData validation failed!");
+
+    // Log the value
+    if (this->_logging)
+    {
+        std::string message = value.string();
+        this->onSendLog(message);
+    }
+
+    // Send the serialized value
+    return this->send_serialized(serialized);
+}
+
 bool Receiver::onReceive(size_t type, const void* data, size_t size)
 {
     switch (type)
@@ -168,6 +240,82 @@ bool Receiver::onReceive(size_t type, const void* data, size_t size)
             onReceive(DisconnectRequestValue);
             return true;
         }
+        case FBE::proto::LoginDataModel::fbe_type():
+        {
+            // Deserialize the value from the FBE stream
+            LoginDataModel.attach(data, size);
+            assert(LoginDataModel.verify() && "proto::LoginData validation failed!");
+            [[maybe_unused]] size_t deserialized = LoginDataModel.deserialize(LoginDataValue);
+            assert((deserialized > 0) && "proto::LoginData deserialization failed!");
+
+            // Log the value
+            if (this->_logging)
+            {
+                std::string message = LoginDataValue.string();
+                this->onReceiveLog(message);
+            }
+
+            // Call receive handler with deserialized value
+            onReceive(LoginDataValue);
+            return true;
+        }
+        case FBE::proto::ApplyDataModel::fbe_type():
+        {
+            // Deserialize the value from the FBE stream
+            ApplyDataModel.attach(data, size);
+            assert(ApplyDataModel.verify() && "proto::ApplyData validation failed!");
+            [[maybe_unused]] size_t deserialized = ApplyDataModel.deserialize(ApplyDataValue);
+            assert((deserialized > 0) && "proto::ApplyData deserialization failed!");
+
+            // Log the value
+            if (this->_logging)
+            {
+                std::string message = ApplyDataValue.string();
+                this->onReceiveLog(message);
+            }
+
+            // Call receive handler with deserialized value
+            onReceive(ApplyDataValue);
+            return true;
+        }
+        case FBE::proto::TransDataModel::fbe_type():
+        {
+            // Deserialize the value from the FBE stream
+            TransDataModel.attach(data, size);
+            assert(TransDataModel.verify() && "proto::TransData validation failed!");
+            [[maybe_unused]] size_t deserialized = TransDataModel.deserialize(TransDataValue);
+            assert((deserialized > 0) && "proto::TransData deserialization failed!");
+
+            // Log the value
+            if (this->_logging)
+            {
+                std::string message = TransDataValue.string();
+                this->onReceiveLog(message);
+            }
+
+            // Call receive handler with deserialized value
+            onReceive(TransDataValue);
+            return true;
+        }
+        case FBE::proto::CancelDataModel::fbe_type():
+        {
+            // Deserialize the value from the FBE stream
+            CancelDataModel.attach(data, size);
+            assert(CancelDataModel.verify() && "proto::CancelData validation failed!");
+            [[maybe_unused]] size_t deserialized = CancelDataModel.deserialize(CancelDataValue);
+            assert((deserialized > 0) && "proto::CancelData deserialization failed!");
+
+            // Log the value
+            if (this->_logging)
+            {
+                std::string message = CancelDataValue.string();
+                this->onReceiveLog(message);
+            }
+
+            // Call receive handler with deserialized value
+            onReceive(CancelDataValue);
+            return true;
+        }
         default: break;
     }
 
@@ -234,6 +382,62 @@ bool Proxy::onReceive(size_t type, const void* data, size_t size)
             DisconnectRequestModel.model.get_end(fbe_begin);
             return true;
         }
+        case FBE::proto::LoginDataModel::fbe_type():
+        {
+            // Attach the FBE stream to the proxy model
+            LoginDataModel.attach(data, size);
+            assert(LoginDataModel.verify() && "proto::LoginData validation failed!");
+
+            size_t fbe_begin = LoginDataModel.model.get_begin();
+            if (fbe_begin == 0)
+                return false;
+            // Call proxy handler
+            onProxy(LoginDataModel, type, data, size);
+            LoginDataModel.model.get_end(fbe_begin);
+            return true;
+        }
+        case FBE::proto::ApplyDataModel::fbe_type():
+        {
+            // Attach the FBE stream to the proxy model
+            ApplyDataModel.attach(data, size);
+            assert(ApplyDataModel.verify() && "proto::ApplyData validation failed!");
+
+            size_t fbe_begin = ApplyDataModel.model.get_begin();
+            if (fbe_begin == 0)
+                return false;
+            // Call proxy handler
+            onProxy(ApplyDataModel, type, data, size);
+            ApplyDataModel.model.get_end(fbe_begin);
+            return true;
+        }
+        case FBE::proto::TransDataModel::fbe_type():
+        {
+            // Attach the FBE stream to the proxy model
+            TransDataModel.attach(data, size);
+            assert(TransDataModel.verify() && "proto::TransData validation failed!");
+
+            size_t fbe_begin = TransDataModel.model.get_begin();
+            if (fbe_begin == 0)
+                return false;
+            // Call proxy handler
+            onProxy(TransDataModel, type, data, size);
+            TransDataModel.model.get_end(fbe_begin);
+            return true;
+        }
+        case FBE::proto::CancelDataModel::fbe_type():
+        {
+            // Attach the FBE stream to the proxy model
+            CancelDataModel.attach(data, size);
+            assert(CancelDataModel.verify() && "proto::CancelData validation failed!");
+
+            size_t fbe_begin = CancelDataModel.model.get_begin();
+            if (fbe_begin == 0)
+                return false;
+            // Call proxy handler
+            onProxy(CancelDataModel, type, data, size);
+            CancelDataModel.model.get_end(fbe_begin);
+            return true;
+        }
         default: break;
     }
 
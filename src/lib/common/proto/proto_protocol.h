@@ -29,7 +29,7 @@ struct ProtocolVersion
     // Protocol major version
     static const int major = 1;
     // Protocol minor version
-    static const int minor = 0;
+    static const int minor = 2;
 };
 
 // Fast Binary Encoding proto sender
@@ -41,6 +41,10 @@ public:
         , MessageRejectModel(this->_buffer)
         , MessageNotifyModel(this->_buffer)
         , DisconnectRequestModel(this->_buffer)
+        , LoginDataModel(this->_buffer)
+        , ApplyDataModel(this->_buffer)
+        , TransDataModel(this->_buffer)
+        , CancelDataModel(this->_buffer)
     {}
     Sender(const Sender&) = delete;
     Sender(Sender&&) noexcept = delete;
@@ -53,6 +57,10 @@ public:
     size_t send(const ::proto::MessageReject& value);
     size_t send(const ::proto::MessageNotify& value);
     size_t send(const ::proto::DisconnectRequest& value);
+    size_t send(const ::proto::LoginData& value);
+    size_t send(const ::proto::ApplyData& value);
+    size_t send(const ::proto::TransData& value);
+    size_t send(const ::proto::CancelData& value);
 
 public:
     // Sender models accessors
@@ -60,6 +68,10 @@ public:
     FBE::proto::MessageRejectModel MessageRejectModel;
     FBE::proto::MessageNotifyModel MessageNotifyModel;
     FBE::proto::DisconnectRequestModel DisconnectRequestModel;
+    FBE::proto::LoginDataModel LoginDataModel;
+    FBE::proto::ApplyDataModel ApplyDataModel;
+    FBE::proto::TransDataModel TransDataModel;
+    FBE::proto::CancelDataModel CancelDataModel;
 };
 
 // Fast Binary Encoding proto receiver
@@ -80,6 +92,10 @@ protected:
     virtual void onReceive(const ::proto::MessageReject& value) {}
     virtual void onReceive(const ::proto::MessageNotify& value) {}
     virtual void onReceive(const ::proto::DisconnectRequest& value) {}
+    virtual void onReceive(const ::proto::LoginData& value) {}
+    virtual void onReceive(const ::proto::ApplyData& value) {}
+    virtual void onReceive(const ::proto::TransData& value) {}
+    virtual void onReceive(const ::proto::CancelData& value) {}
 
     // Receive message handler
     bool onReceive(size_t type, const void* data, size_t size) override;
@@ -90,12 +106,20 @@ private:
     ::proto::MessageReject MessageRejectValue;
     ::proto::MessageNotify MessageNotifyValue;
     ::proto::DisconnectRequest DisconnectRequestValue;
+    ::proto::LoginData LoginDataValue;
+    ::proto::ApplyData ApplyDataValue;
+    ::proto::TransData TransDataValue;
+    ::proto::CancelData CancelDataValue;
 
     // Receiver models accessors
     FBE::proto::OriginMessageModel OriginMessageModel;
     FBE::proto::MessageRejectModel MessageRejectModel;
     FBE::proto::MessageNotifyModel MessageNotifyModel;
     FBE::proto::DisconnectRequestModel DisconnectRequestModel;
+    FBE::proto::LoginDataModel LoginDataModel;
+    FBE::proto::ApplyDataModel ApplyDataModel;
+    FBE::proto::TransDataModel TransDataModel;
+    FBE::proto::CancelDataModel CancelDataModel;
 };
 
 // Fast Binary Encoding proto proxy
@@ -116,6 +140,10 @@ protected:
     virtual void onProxy(FBE::proto::MessageRejectModel& model, size_t type, const void* data, size_t size) {}
     virtual void onProxy(FBE::proto::MessageNotifyModel& model, size_t type, const void* data, size_t size) {}
     virtual void onProxy(FBE::proto::DisconnectRequestModel& model, size_t type, const void* data, size_t size) {}
+    virtual void onProxy(FBE::proto::LoginDataModel& model, size_t type, const void* data, size_t size) {}
+    virtual void onProxy(FBE::proto::ApplyDataModel& model, size_t type, const void* data, size_t size) {}
+    virtual void onProxy(FBE::proto::TransDataModel& model, size_t type, const void* data, size_t size) {}
+    virtual void onProxy(FBE::proto::CancelDataModel& model, size_t type, const void* data, size_t size) {}
 
     // Receive message handler
     bool onReceive(size_t type, const void* data, size_t size) override;
@@ -126,6 +154,10 @@ private:
     FBE::proto::MessageRejectModel MessageRejectModel;
     FBE::proto::MessageNotifyModel MessageNotifyModel;
     FBE::proto::DisconnectRequestModel DisconnectRequestModel;
+    FBE::proto::LoginDataModel LoginDataModel;
+    FBE::proto::ApplyDataModel ApplyDataModel;
+    FBE::proto::TransDataModel TransDataModel;
+    FBE::proto::CancelDataModel CancelDataModel;
 };
 
 // Fast Binary Encoding proto client
@@ -158,22 +190,38 @@ protected:
     virtual bool onReceiveResponse(const ::proto::MessageReject& response) { return false; }
     virtual bool onReceiveResponse(const ::proto::MessageNotify& response) { return false; }
     virtual bool onReceiveResponse(const ::proto::DisconnectRequest& response) { return false; }
+    virtual bool onReceiveResponse(const ::proto::LoginData& response) { return false; }
+    virtual bool onReceiveResponse(const ::proto::ApplyData& response) { return false; }
+    virtual bool onReceiveResponse(const ::proto::TransData& response) { return false; }
+    virtual bool onReceiveResponse(const ::proto::CancelData& response) { return false; }
 
     virtual bool onReceiveReject(const ::proto::MessageReject& reject);
 
     virtual bool onReceiveReject(const ::proto::OriginMessage& reject) { return false; }
     virtual bool onReceiveReject(const ::proto::MessageNotify& reject) { return false; }
     virtual bool onReceiveReject(const ::proto::DisconnectRequest& reject) { return false; }
+    virtual bool onReceiveReject(const ::proto::LoginData& reject) { return false; }
+    virtual bool onReceiveReject(const ::proto::ApplyData& reject) { return false; }
+    virtual bool onReceiveReject(const ::proto::TransData& reject) { return false; }
+    virtual bool onReceiveReject(const ::proto::CancelData& reject) { return false; }
 
     virtual void onReceiveNotify(const ::proto::OriginMessage& notify) {}
     virtual void onReceiveNotify(const ::proto::MessageReject& notify) {}
     virtual void onReceiveNotify(const ::proto::MessageNotify& notify) {}
     virtual void onReceiveNotify(const ::proto::DisconnectRequest& notify) {}
+    virtual void onReceiveNotify(const ::proto::LoginData& notify) {}
+    virtual void onReceiveNotify(const ::proto::ApplyData& notify) {}
+    virtual void onReceiveNotify(const ::proto::TransData& notify) {}
+    virtual void onReceiveNotify(const ::proto::CancelData& notify) {}
 
     virtual void onReceive(const ::proto::OriginMessage& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
     virtual void onReceive(const ::proto::MessageReject& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
     virtual void onReceive(const ::proto::MessageNotify& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
     virtual void onReceive(const ::proto::DisconnectRequest& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
+    virtual void onReceive(const ::proto::LoginData& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
+    virtual void onReceive(const ::proto::ApplyData& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
+    virtual void onReceive(const ::proto::TransData& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
+    virtual void onReceive(const ::proto::CancelData& value) override { if (!onReceiveResponse(value) && !onReceiveReject(value)) onReceiveNotify(value); }
 
     // Reset client requests
     virtual void reset_requests();
@@ -7,11 +7,36 @@
 
 #include "server/asio/service.h"
 
+#include <algorithm>
+#include <thread>
+
 class AsioService : public CppServer::Asio::Service
 {
 public:
     using CppServer::Asio::Service::Service;
 
+    // The IO service shared by all the sessions and transfers, one thread for each core.
+    // It is a thread pool, the handlers of each connection are serialized by its own strand.
+    static std::shared_ptr<AsioService> shared()
+    {
+        static std::shared_ptr<AsioService> ins = [] {
+            int threads = static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+            auto service = std::make_shared<AsioService>(threads, true);
+            service->Start();
+            return service;
+        }();
+        return ins;
+    }
+
+    // Stop the shared service before the application quits, its threads must not run into the
+    // static destruction. The running handlers finish first, call it out of the io threads.
+    static void stopShared()
+    {
+        auto service = shared();
+        if (service->IsStarted())
+            service->Stop();
+    }
+
 protected:
     void onError(int error, const std::string &category, const std::string &message) override
     {
@@ -4,10 +4,14 @@
 
 #include "protoclient.h"
 
+#include <algorithm>
+
 void ProtoClient::DisconnectAndStop()
 {
     _stop = true;
     _connect_replay = false;
+    if (_reconnect_timer)
+        _reconnect_timer->Cancel();
     DisconnectAsync();
     while (IsConnected())
         CppCommon::Thread::Yield();
@@ -15,7 +19,24 @@ void ProtoClient::DisconnectAndStop()
 
 bool ProtoClient::hasConnected(const std::string &ip)
 {
-    return ip == _connected_host;
+    return ip == connectedHost();
+}
+
+bool ProtoClient::typedSupported(const std::string &ip)
+{
+    return _typed_remote && ip == connectedHost();
+}
+
+std::string ProtoClient::connectedHost()
+{
+    std::scoped_lock locker(_host_lock);
+    return _connected_host;
+}
+
+void ProtoClient::setConnectedHost(const std::string &host)
+{
+    std::scoped_lock locker(_host_lock);
+    _connected_host = host;
 }
 
 bool ProtoClient::startHeartbeat()
@@ -30,21 +51,46 @@ bool ProtoClient::startHeartbeat()
     return pingMessageStart();
 }
 
-void ProtoClient::handlePong(const std::string &remote)
+void ProtoClient::handlePong(const std::string &remote, bool typed)
 {
     // std::cout << "client pong: " << remote << std::endl;
-    _connected_host = remote;
+    setConnectedHost(remote);
+    _typed_remote = typed;
     _nopong_count.store(0);
 }
 
+void ProtoClient::setWarm(bool warm)
+{
+    _warm = warm;
+    if (!IsHandshaked())
+        return;
+
+    proto::MessageNotify ping;
+    ping.notification = versionNotify(warm ? "warm" : "ping");
+    std::scoped_lock locker(_sender_lock);
+    send(ping);
+}
+
+template<typename T>
+void ProtoClient::replyData(const T &data)
+{
+    receiveData(data, [this](const auto &reply) {
+        std::scoped_lock locker(_sender_lock);
+        send(reply);
+    });
+}
+
 bool ProtoClient::pingMessageStart()
 {
-    if (_connected_host.empty() || !IsHandshaked())
+    if (connectedHost().empty() || !IsHandshaked())
         return false;
 
     proto::MessageNotify ping;
-    ping.notification = "ping";
-    send(ping);
+    ping.notification = versionNotify(_warm ? "warm" : "ping");
+    {
+        std::scoped_lock locker(_sender_lock);
+        send(ping);
+    }
 
     _ping_timer->Setup(CppCommon::Timespan::seconds(HEARTBEAT_INTERVAL));
     return _ping_timer->WaitAsync();
@@ -52,7 +98,8 @@ bool ProtoClient::pingMessageStart()
 
 void ProtoClient::pingTimerStop()
 {
-    _connected_host = "";
+    setConnectedHost("");
+    _typed_remote = false;
     if (_ping_timer) {
         _ping_timer->Cancel();
     }
@@ -68,13 +115,37 @@ void ProtoClient::onHeartbeatTimeout(bool canceled)
             pingMessageStart();
         } else {
             // no pong more than 3 times
+            std::string host = connectedHost();
             if (_callbacks)
-                _callbacks->onStateChanged(RPC_PINGOUT, _connected_host);
+                _callbacks->onStateChanged(RPC_PINGOUT, host);
             pingTimerStop();
         }
     }
 }
 
+void ProtoClient::scheduleReconnect()
+{
+    if (!_reconnect_timer) {
+        _reconnect_timer = std::make_shared<Timer>(service());
+
+        std::function<void(bool)> _action = std::bind(&ProtoClient::onReconnectTimeout, this, std::placeholders::_1);
+        _reconnect_timer->Setup(_action);
+    }
+
+    // wait on the timer, not block the io thread of the other connections
+    int delay = _reconnect_delay.load();
+    _reconnect_delay.store(std::min(delay * 2, RECONNECT_MAX_DELAY));
+    _reconnect_timer->Setup(CppCommon::Timespan::milliseconds(delay));
+    _reconnect_timer->WaitAsync();
+}
+
+void ProtoClient::onReconnectTimeout(bool canceled)
+{
+    // Try to connect again
+    if (!canceled && !_stop)
+        ConnectAsync();
+}
+
 bool ProtoClient::connectReplyed()
 {
     return _connect_replay;
@@ -84,19 +155,24 @@ void ProtoClient::onConnected()
 {
     // std::cout << "Protocol client connected a new session with Id " << id() << " ip:" << address() << std::endl;
     // For SSL: must wait handshake completed, so move into handshaked
+
+    // resume the last session to the server before the handshake starts
+    SSLSessionCache::instance()->resume(stream().native_handle(), address(), port());
 }
 
 void ProtoClient::onHandshaked()
 {
     // std::cout << "Proto SSL client handshaked a new session with Id " << id() << std::endl;
     _connect_replay = true;
+    _reconnect_delay = RECONNECT_MIN_DELAY;
 
     // Reset FBE protocol buffers
     reset();
 
-    _connected_host = socket().remote_endpoint().address().to_string();
+    std::string host = socket().remote_endpoint().address().to_string();
+    setConnectedHost(host);
     if (_callbacks) {
-        _callbacks->onStateChanged(RPC_CONNECTED, _connected_host);
+        _callbacks->onStateChanged(RPC_CONNECTED, host);
     }
 }
 
@@ -108,18 +184,15 @@ void ProtoClient::onDisconnected()
     bool retry = true;
     if (_callbacks) {
         //can not get the remote address if has not connected yet.
-         retry = _callbacks->onStateChanged(RPC_DISCONNECTED, _connected_host);
+         std::string host = connectedHost();
+         retry = _callbacks->onStateChanged(RPC_DISCONNECTED, host);
     }
     pingTimerStop();
+    // no reply will come for the pending calls
+    failRequests("");
 
-    if (retry) {
-        // Wait for a while...
-        CppCommon::Thread::Sleep(1000);
-
-        // Try to connect again
-        if (!_stop)
-            ConnectAsync();
-    }
+    if (retry && !_stop)
+        scheduleReconnect();
 }
 
 void ProtoClient::onError(int error, const std::string &category, const std::string &message)
@@ -146,12 +219,9 @@ void ProtoClient::onReceive(const ::proto::DisconnectRequest &request)
 
 void ProtoClient::onReceive(const ::proto::OriginMessage &response)
 {
-    // notify response if the request from myself, request.get()
-    if (_self_request.load(std::memory_order_relaxed)) {
-        _self_request.store(false, std::memory_order_relaxed);
-        FinalClient::onReceiveResponse(response);
+    // the reply of the request from myself
+    if (completeRequest(response))
         return;
-    }
 
     // Send response
     proto::OriginMessage reply;
@@ -164,13 +234,16 @@ void ProtoClient::onReceive(const ::proto::OriginMessage &response)
         reply.json_msg = response.json_msg;
     }
 
-    if (!reply.json_msg.empty())
+    if (!reply.json_msg.empty()) {
+        std::scoped_lock locker(_sender_lock);
         send(reply);
+    }
 }
 
 void ProtoClient::onReceive(const ::proto::MessageReject &reject)
 {
-    FinalClient::onReceive(reject);
+    if (!rejectRequest(reject.id))
+        FinalClient::onReceive(reject);
     //std::cout << "Received reject: " << reject << std::endl;
 }
 
@@ -181,7 +254,27 @@ void ProtoClient::onReceive(const ::proto::MessageNotify &notify)
 
     // mark pinged
     auto remote = socket().remote_endpoint().address().to_string();
-    handlePong(remote);
+    handlePong(remote, typedNotify(notify.notification));
+}
+
+void ProtoClient::onReceive(const ::proto::LoginData &data)
+{
+    replyData(data);
+}
+
+void ProtoClient::onReceive(const ::proto::ApplyData &data)
+{
+    replyData(data);
+}
+
+void ProtoClient::onReceive(const ::proto::TransData &data)
+{
+    replyData(data);
+}
+
+void ProtoClient::onReceive(const ::proto::CancelData &data)
+{
+    replyData(data);
 }
 
 // Protocol implementation
@@ -8,10 +8,16 @@
 #include "asioservice.h"
 #include "protoendpoint.h"
 
+#include "sslsessioncache.h"
+
 #include "server/asio/ssl_client.h"
 #include "string/format.h"
 #include "threads/thread.h"
 
+// the reconnect waits double from the min to the max, in milliseconds
+#define RECONNECT_MIN_DELAY 100
+#define RECONNECT_MAX_DELAY 5000
+
 class ProtoClient : public CppServer::Asio::SSLClient, public ProtoEndpoint
 {
 public:
@@ -23,8 +29,14 @@ public:
 
     bool hasConnected(const std::string &ip) override;
 
+    bool typedSupported(const std::string &ip) override;
+
     bool startHeartbeat();
 
+    // park the connection for the later use or take it back, the remote is told at once. The
+    // parked one pings as "warm", the remote does not take it as connected.
+    void setWarm(bool warm);
+
 protected:
     void onConnected() override;
 
@@ -39,27 +51,48 @@ protected:
     void onReceive(const ::proto::OriginMessage &response) override;
     void onReceive(const ::proto::MessageReject &reject) override;
     void onReceive(const ::proto::MessageNotify &notify) override;
+    void onReceive(const ::proto::LoginData &data) override;
+    void onReceive(const ::proto::ApplyData &data) override;
+    void onReceive(const ::proto::TransData &data) override;
+    void onReceive(const ::proto::CancelData &data) override;
 
     // Protocol implementation
     void onReceived(const void *buffer, size_t size) override;
     size_t onSend(const void *data, size_t size) override;
 
 private:
-    void handlePong(const std::string &remote);
+    // the timer and the receive run on different strands
+    std::string connectedHost();
+    void setConnectedHost(const std::string &host);
+
+    void handlePong(const std::string &remote, bool typed);
+
+    template<typename T>
+    void replyData(const T &data);
 
     bool pingMessageStart();
     void pingTimerStop();
 
     void onHeartbeatTimeout(bool canceled);
 
+    void scheduleReconnect();
+    void onReconnectTimeout(bool canceled);
+
 private:
     std::atomic<bool> _stop { false };
     std::atomic<bool> _connect_replay { false };
 
+    std::mutex _host_lock;
     std::string _connected_host = { "" };
     // heartbeat: ping <-> pong
     std::shared_ptr<Timer> _ping_timer { nullptr };
     std::atomic<int> _nopong_count { 0 };
+    // the server tells its protocol version in the pong
+    std::atomic<bool> _typed_remote { false };
+    std::atomic<bool> _warm { false };
+
+    std::shared_ptr<Timer> _reconnect_timer { nullptr };
+    std::atomic<int> _reconnect_delay { RECONNECT_MIN_DELAY };
 };
 
 #endif // PROTOCLIENT_H
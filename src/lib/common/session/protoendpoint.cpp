@@ -2,10 +2,24 @@
 //
 // SPDX-License-Identifier: GPL-3.0-or-later
 
-#include "threads/thread.h"
-
 #include "protoendpoint.h"
 
+#include <cstdio>
+#include <future>
+#include <vector>
+
+ProtoEndpoint::~ProtoEndpoint()
+{
+    {
+        std::scoped_lock locker(_pending_lock);
+        _stoped = true;
+        _pending_calls.clear();
+    }
+    _pending_cond.notify_all();
+    if (_watchdog.joinable())
+        _watchdog.join();
+}
+
 void ProtoEndpoint::setCallbacks(std::shared_ptr<SessionCallInterface> callbacks)
 {
     _callbacks = callbacks;
@@ -13,84 +27,179 @@ void ProtoEndpoint::setCallbacks(std::shared_ptr<SessionCallInterface> callbacks
 
 void ProtoEndpoint::sendDisRequest()
 {
+    std::scoped_lock locker(_sender_lock);
     proto::DisconnectRequest dis;
     this->request(dis);
 }
 
-proto::OriginMessage ProtoEndpoint::syncRequest(const std::string &target, const proto::OriginMessage &msg)
+proto::OriginMessage ProtoEndpoint::syncRequest(const std::string &target, const proto::OriginMessage &msg, int timeout)
 {
-    _active_traget = target;
-    _self_request.store(true, std::memory_order_relaxed);
-
-    try {
-        return this->request(msg).get();
-    } catch (const std::exception &ex) {
-        // 捕获并处理异常
-        std::cout << "syncRequest throw exception: " << ex.what() << std::endl;
-    }
+    auto promise = std::make_shared<std::promise<std::string>>();
+    std::future<std::string> future = promise->get_future();
+
+    bool called = asyncCall(target, msg, timeout, [promise](int32_t type, const std::string &response) {
+        promise->set_value(response);
+    });
 
-    return proto::OriginMessage();
+    proto::OriginMessage res;
+    res.id = msg.id;
+    res.mask = msg.mask;
+    // not called, e.g. stopped, the handler may never run
+    if (!called)
+        return res;
+    res.json_msg = future.get();
+    return res;
 }
 
 void ProtoEndpoint::asyncRequestWithHandler(const std::string &target, const proto::OriginMessage &request, RpcHandler resultHandler)
 {
-    asyncRequest(target, request);  // 发送异步请求
-
-    int32_t type = request.mask;  // 获取请求的类型
-    // 启动一个新的线程来处理结果
-    std::thread handlerThread([this, type, resultHandler]() {
-        std::string response = getResponse(type);  // 获取响应
-        resultHandler(type, response);  // 调用结果处理函数
-    });
+    asyncCall(target, request, REQUEST_TIMEOUT, std::move(resultHandler));
+}
 
-    // 在启动的新线程中处理结果，主线程可以继续执行其他任务
-    handlerThread.detach();
+bool ProtoEndpoint::asyncCall(const std::string &target, const proto::OriginMessage &request, int timeout, RpcHandler resultHandler)
+{
+    // the mask of the reply is the result, report the type of the request
+    int32_t type = request.mask;
+    DataHandler<proto::OriginMessage> handler = [type, resultHandler](const proto::OriginMessage *reply) {
+        if (resultHandler)
+            resultHandler(type, reply ? reply->json_msg : "");
+    };
+    return asyncCall<proto::OriginMessage>(target, request, timeout, std::move(handler));
 }
 
+std::string ProtoEndpoint::versionNotify(const std::string &word)
+{
+    return word + " " + std::to_string(FBE::proto::ProtocolVersion::major) + "."
+            + std::to_string(FBE::proto::ProtocolVersion::minor);
+}
 
-void ProtoEndpoint::asyncRequest(const std::string &target, const proto::OriginMessage &msg)
+bool ProtoEndpoint::typedNotify(const std::string &notify)
 {
-    _active_traget = target;
-    _self_request.store(true, std::memory_order_relaxed);
+    // the old remotes send "ping" or "pong" only
+    int major = 0, minor = 0;
+    auto pos = notify.find(' ');
+    if (pos == std::string::npos || sscanf(notify.c_str() + pos + 1, "%d.%d", &major, &minor) != 2)
+        return false;
+    // the typed messages are added in 1.1, and marked the replies in 1.2
+    return major > 1 || (major == 1 && minor >= 2);
+}
 
-    // new request comeing, reset all pending.
-    this->reset_requests();
-    //std::cout << "pending request: " << _responses_by_type.size() << std::endl;
+bool ProtoEndpoint::warmNotify(const std::string &notify)
+{
+    // handled by the remotes since 1.2, the same as the typed ones
+    return notify.compare(0, 5, "warm ") == 0;
+}
 
-    int32_t type = msg.mask;
-    std::future<proto::OriginMessage> futureResponse = this->request(msg);
+bool ProtoEndpoint::rejectRequest(const FBE::uuid_t &id)
+{
+    PendingCall call;
+    {
+        std::scoped_lock locker(_pending_lock);
+        auto it = _pending_calls.find(id);
+        if (it == _pending_calls.end())
+            return false;
+        call = std::move(it->second);
+        _pending_calls.erase(it);
+    }
+    if (call.handler)
+        call.handler(nullptr);
+    return true;
+}
 
-    _responses_by_type.insert(std::make_pair(type, std::move(futureResponse)));
+void ProtoEndpoint::failRequests(const std::string &target)
+{
+    std::vector<PendingCall> failed;
+    {
+        std::scoped_lock locker(_pending_lock);
+        auto it = _pending_calls.begin();
+        while (it != _pending_calls.end()) {
+            if (target.empty() || it->second.target == target) {
+                failed.push_back(std::move(it->second));
+                it = _pending_calls.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    for (auto &call : failed) {
+        if (call.handler)
+            call.handler(nullptr);
+    }
 }
 
-std::string ProtoEndpoint::getResponse(int32_t type)
+bool ProtoEndpoint::addCall(const std::string &target, const FBE::uuid_t &id, int32_t type, size_t fbe_type, int timeout, ReplyHandler handler)
 {
-    std::scoped_lock locker(this->_lock);
+    PendingCall call;
+    call.target = target;
+    call.type = type;
+    call.fbe_type = fbe_type;
+    call.deadline = timeout > 0 ? std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout)
+                                : std::chrono::steady_clock::time_point::max();
+    call.handler = std::move(handler);
+
+    // register before sending, the reply may come back before the send returns
+    {
+        std::scoped_lock locker(_pending_lock);
+        if (_stoped)
+            return false;
+        _pending_calls[id] = std::move(call);
+        if (timeout > 0 && !_watchdog.joinable())
+            _watchdog = std::thread(&ProtoEndpoint::watchRequests, this);
+    }
+    _pending_cond.notify_one();
+    return true;
+}
 
-    auto it = _responses_by_type.find(type);
-    if (it != _responses_by_type.end())
+bool ProtoEndpoint::completeCall(const FBE::uuid_t &id, size_t fbe_type, const void *reply)
+{
+    PendingCall call;
     {
-        std::future<proto::OriginMessage>& future = it->second;
-
-        int wait_cout = 0;
-        do {
-            if (future.valid() && future.wait_for(std::chrono::milliseconds(wait_cout > 0 ? 1 : 0)) == std::future_status::ready) {
-                // 如果有响应，立即返回
-                try {
-                    auto res = future.get();
-                    _responses_by_type.erase(it);
-                    return res.json_msg;
-                } catch (const std::exception &ex) {
-                    // 捕获并处理异常
-                    std::cout << "future throw exception: " << ex.what() << std::endl;
-                    break;
-                }
-            }
-            wait_cout++;
-            CppCommon::Thread::Yield();
-        } while (wait_cout < 3000); // timeout 3s
+        std::scoped_lock locker(_pending_lock);
+        auto it = _pending_calls.find(id);
+        if (it == _pending_calls.end() || it->second.fbe_type != fbe_type)
+            return false;
+        call = std::move(it->second);
+        _pending_calls.erase(it);
+    }
+    if (call.handler)
+        call.handler(reply);
+    return true;
+}
 
-        _responses_by_type.erase(it);
+void ProtoEndpoint::watchRequests()
+{
+    std::unique_lock<std::mutex> locker(_pending_lock);
+    while (!_stoped) {
+        auto now = std::chrono::steady_clock::now();
+        auto next = std::chrono::steady_clock::time_point::max();
+        std::vector<PendingCall> expired;
+
+        auto it = _pending_calls.begin();
+        while (it != _pending_calls.end()) {
+            if (it->second.deadline <= now) {
+                expired.push_back(std::move(it->second));
+                it = _pending_calls.erase(it);
+            } else {
+                next = std::min(next, it->second.deadline);
+                ++it;
+            }
+        }
+
+        if (!expired.empty()) {
+            // call the handlers out of the lock, they may send another request
+            locker.unlock();
+            for (auto &call : expired) {
+                std::cout << "request timeout, type: " << call.type << std::endl;
+                if (call.handler)
+                    call.handler(nullptr);
+            }
+            locker.lock();
+            continue;
+        }
+
+        if (next == std::chrono::steady_clock::time_point::max())
+            _pending_cond.wait(locker);
+        else
+            _pending_cond.wait_until(locker, next);
     }
-    return "";
 }
@@ -9,45 +9,156 @@
 #include "server/asio/timer.h"
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 // hearbeat timeout
 #define HEARTBEAT_INTERVAL 2
+// the deadline of the async request, ms
+#define REQUEST_TIMEOUT 3000
 
 using CppServer::Asio::Timer;
 using RpcHandler = std::function<void(int32_t type, const std::string &response)>;
-
+// the reply of the typed message, nullptr if failed
+template<typename T>
+using DataHandler = std::function<void(const T *reply)>;
+
+// The requests are matched to their replies by the message id, so any number of calls can be
+// outstanding on one session at the same time. A reply is recognized by the id of a pending call,
+// any other message is a request from the remote.
+// The typed messages (LoginData, ApplyData, TransData, CancelData) are replied by the same type,
+// they are only sent to the remotes which tell their protocol version in the ping/pong.
 class ProtoEndpoint: public FBE::proto::FinalClient
 {
 public:
+    ~ProtoEndpoint() override;
 
     void setCallbacks(std::shared_ptr<SessionCallInterface> callbacks);
 
     void sendDisRequest();
-    proto::OriginMessage syncRequest(const std::string &target, const proto::OriginMessage &msg);
+    // wait for the reply, timeout 0 waits until the reply or the disconnection.
+    // An empty message is returned if failed.
+    proto::OriginMessage syncRequest(const std::string &target, const proto::OriginMessage &msg, int timeout = 0);
 
     // async call request and with 3s timeout result callback
     void asyncRequestWithHandler(const std::string &target, const proto::OriginMessage &request, RpcHandler resultHandler);
 
+    // async call with its own deadline (ms, 0 for none). The handler is called once, with the reply
+    // or with an empty response if failed, timeout, rejected or disconnected.
+    bool asyncCall(const std::string &target, const proto::OriginMessage &request, int timeout, RpcHandler resultHandler);
+
+    // async call with a typed message, the handler gets the reply of the same type.
+    template<typename T>
+    bool asyncCall(const std::string &target, const T &request, int timeout, DataHandler<T> resultHandler)
+    {
+        ReplyHandler handler = [resultHandler](const void *reply) {
+            if (resultHandler)
+                resultHandler(static_cast<const T *>(reply));
+        };
+        if (!addCall(target, request.id, request.mask, request.fbe_type(), timeout, std::move(handler)))
+            return false;
+
+        {
+            std::scoped_lock locker(_sender_lock);
+            _active_traget = target;
+            if (this->send(request) > 0)
+                return true;
+        }
+        std::cout << "send request failed, type: " << request.mask << std::endl;
+        // no reply will come
+        rejectRequest(request.id);
+        return false;
+    }
+
     virtual bool hasConnected(const std::string &ip) { return false; }
 
-private:
-    void asyncRequest(const std::string &target, const proto::OriginMessage &msg);
-    std::string getResponse(int32_t type);
+    // whether the remote handles the typed messages
+    virtual bool typedSupported(const std::string &ip) { return false; }
+
+    // the ping/pong notification with my protocol version, e.g. "ping 1.2"
+    static std::string versionNotify(const std::string &word);
+    // whether the notification is from a remote which handles the typed messages
+    static bool typedNotify(const std::string &notify);
+    // the ping of a parked connection, e.g. "warm 1.2". It is kept connected for the later use,
+    // the remote does not take it as connected until a normal ping comes.
+    static bool warmNotify(const std::string &notify);
 
 protected:
-    std::shared_ptr<SessionCallInterface> _callbacks { nullptr };
+    // complete the pending call replied by the message, return false if it is not a reply.
+    template<typename T>
+    bool completeRequest(const T &response)
+    {
+        return completeCall(response.id, response.fbe_type(), &response);
+    }
+    bool rejectRequest(const FBE::uuid_t &id);
+    // fail the pending calls to the target, or all if it is empty.
+    void failRequests(const std::string &target);
+
+    // handle the typed message from the remote, reply by the sender. The message is rejected if
+    // no one handles it.
+    template<typename T, typename Sender>
+    void receiveData(const T &request, Sender sender)
+    {
+        if (request.reply) {
+            // the reply of my request, or out of its time. never handle a reply as the request,
+            // its reply would come back as another request.
+            if (!completeRequest(request))
+                std::cout << "drop the unmatched reply, type: " << request.mask << std::endl;
+            return;
+        }
+
+        T response;
+        response.id = request.id;
+        response.mask = request.mask;
+        response.reply = true;
+        if (_callbacks && _callbacks->onReceivedMessage(request, &response)) {
+            sender(response);
+            return;
+        }
+
+        proto::MessageReject reject;
+        reject.id = request.id;
+        reject.error = "Unsupported message!";
+        sender(reject);
+    }
 
-    //mask self request, default false for remote
-    std::atomic<bool> _self_request { false };
+protected:
+    std::shared_ptr<SessionCallInterface> _callbacks { nullptr };
 
     //current active request target
     std::string _active_traget = { "" };
 
+    // the target and the send must be set together, and the sends share the buffer of FBE
+    std::mutex _sender_lock;
+
 private:
-    std::mutex _lock;
-    // type, future
-    std::unordered_map<int32_t, std::future<proto::OriginMessage>> _responses_by_type;
+    // the reply is the message of the request type, nullptr if failed
+    using ReplyHandler = std::function<void(const void *reply)>;
+
+    struct PendingCall {
+        std::string target;
+        int32_t type { 0 };
+        // the fbe type of the request, the reply must be the same one
+        size_t fbe_type { 0 };
+        std::chrono::steady_clock::time_point deadline;
+        ReplyHandler handler;
+    };
+
+    bool addCall(const std::string &target, const FBE::uuid_t &id, int32_t type, size_t fbe_type, int timeout, ReplyHandler handler);
+    bool completeCall(const FBE::uuid_t &id, size_t fbe_type, const void *reply);
+    void watchRequests();
+
+    std::mutex _pending_lock;
+    std::condition_variable _pending_cond;
+    // <message id, call>
+    std::unordered_map<FBE::uuid_t, PendingCall> _pending_calls;
+    // fail the calls out of their deadlines
+    std::thread _watchdog;
+    bool _stoped { false };
 };
 
 #endif // PROTOENDPOINT_H
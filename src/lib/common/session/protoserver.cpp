@@ -5,7 +5,7 @@
 #include "protoserver.h"
 
 using MessageHandler = std::function<void(const proto::OriginMessage &request, proto::OriginMessage *response)>;
-using NotifyHandler = std::function<void(const std::string &addr)>;
+using NotifyHandler = std::function<void(const std::string &addr, const std::string &notify)>;
 
 class ProtoSession : public CppServer::Asio::SSLSession, public FBE::proto::FinalClient
 {
@@ -22,6 +22,22 @@ public:
         _notifyhandler = std::move(cb);
     }
 
+    void setServer(ProtoServer *server)
+    {
+        _server = server;
+    }
+
+    // the remote can not be got from the socket after disconnected
+    void setRemote(const std::string &remote)
+    {
+        _remote = remote;
+    }
+
+    const std::string &remote() const
+    {
+        return _remote;
+    }
+
 protected:
     void onHandshaked() override
     {
@@ -76,13 +92,38 @@ protected:
 
         // Send response
         proto::MessageNotify pong;
-        pong.notification = "pong";
+        pong.notification = ProtoEndpoint::versionNotify("pong");
         send(pong);
 
-        if (_notifyhandler) {
-            std::string addr = socket().remote_endpoint().address().to_string();
-            _notifyhandler(addr);
-        }
+        if (_notifyhandler)
+            _notifyhandler(_remote, notify.notification);
+    }
+
+    void onReceive(const ::proto::MessageReject &reject) override
+    {
+        // the client rejects the request from server
+        if (_server)
+            _server->rejectRequest(reject.id);
+    }
+
+    void onReceive(const ::proto::LoginData &data) override
+    {
+        replyData(data);
+    }
+
+    void onReceive(const ::proto::ApplyData &data) override
+    {
+        replyData(data);
+    }
+
+    void onReceive(const ::proto::TransData &data) override
+    {
+        replyData(data);
+    }
+
+    void onReceive(const ::proto::CancelData &data) override
+    {
+        replyData(data);
     }
 
     // Protocol implementation
@@ -97,81 +138,109 @@ protected:
     }
 
 private:
+    template<typename T>
+    void replyData(const T &data)
+    {
+        if (!_server)
+            return;
+        _server->receiveData(data, [this](const auto &reply) {
+            send(reply);
+        });
+    }
+
     MessageHandler _msghandler { nullptr };
     NotifyHandler _notifyhandler { nullptr };
+    ProtoServer *_server { nullptr };
+    std::string _remote;
 };
 
 
 bool ProtoServer::hasConnected(const std::string &ip)
 {
-    // Try to find the required ip
-    auto it = _session_ids.find(ip);
-    if (it != _session_ids.end()) {
-        return true;
-    }
-    return false;
+    // the parked session is not used until the remote takes it back
+    SessionRegistry::Entry entry;
+    return _registry.find(ip, &entry) && !entry.warm;
 }
 
-bool ProtoServer::startHeartbeat()
+bool ProtoServer::typedSupported(const std::string &ip)
 {
-    if (!_ping_timer) {
-        _ping_timer = std::make_shared<Timer>(service());
+    SessionRegistry::Entry entry;
+    return _registry.find(ip, &entry) && !entry.warm && entry.typed;
+}
+
+void ProtoServer::startWheel()
+{
+    if (_wheel_ticking.exchange(true))
+        return;
+
+    if (!_wheel_timer) {
+        _wheel_timer = std::make_shared<Timer>(service());
 
-        std::function<void(bool)> _action = std::bind(&ProtoServer::onHeartbeatTimeout, this, std::placeholders::_1);
-        _ping_timer->Setup(_action);
+        std::function<void(bool)> _action = std::bind(&ProtoServer::onWheelTick, this, std::placeholders::_1);
+        _wheel_timer->Setup(_action);
     }
 
-    // wait for client ping
-    _ping_timer->Setup(CppCommon::Timespan::seconds(HEARTBEAT_INTERVAL));
-    return _ping_timer->WaitAsync();
+    _wheel_timer->Setup(CppCommon::Timespan::milliseconds(WHEEL_TICK_MS));
+    if (!_wheel_timer->WaitAsync())
+        _wheel_ticking = false;
 }
 
-void ProtoServer::handlePing(const std::string &remote)
+void ProtoServer::handlePing(const std::string &remote, const std::string &notify)
 {
     // std::cout << "server ping: " << remote << std::endl;
-    auto pinging = _ping_remotes.find(remote);
-    if (pinging != _ping_remotes.end()) {
-        pinging->second.store(0);
-    } else {
-        if (_ping_remotes.empty()) {
-            startHeartbeat(); // start hearbeat check while receive client's ping
-        }
-        _ping_remotes.insert(std::make_pair(remote, 0));
+    bool warm = ProtoEndpoint::warmNotify(notify);
+    bool warmChanged = false;
+    if (!_registry.markPinged(remote, ProtoEndpoint::typedNotify(notify), warm, &warmChanged))
+        return;
+
+    // move the deadline of the remote
+    _wheel.schedule(remote, std::chrono::seconds(PING_TIMEOUT));
+    startWheel();
+
+    // the remote parks the session or takes it back, it is disconnected or connected for the apps
+    if (warmChanged && _callbacks) {
+        std::cout << (warm ? "Session parked by: " : "Session taken back by: ") << remote << std::endl;
+        std::string addr(remote);
+        _callbacks->onStateChanged(warm ? RPC_DISCONNECTED : RPC_CONNECTED, addr);
     }
 }
 
-void ProtoServer::onHeartbeatTimeout(bool canceled)
+void ProtoServer::onWheelTick(bool canceled)
 {
-    if (_session_ids.empty() || canceled) {
-        // no any connection session
-        _ping_timer->Cancel();
-        _ping_remotes.clear();
+    if (canceled) {
+        _wheel_ticking = false;
         return;
     }
 
-    std::string outip = "";
-    bool recheck = false;
-    auto it = _ping_remotes.begin();
-    while (it != _ping_remotes.end()) {
-        auto count = it->second.load();
-        if (count < 3) {
-            recheck = true;
-            ++it;
+    auto expired = _wheel.expire(std::chrono::steady_clock::now());
+    for (auto &ip : expired) {
+        SessionRegistry::Entry entry;
+        if (!_registry.find(ip, &entry))
+            continue;
+
+        if (!entry.pinged || entry.warm) {
+            // the parked one has been disconnected for the apps
+            std::cout << "Close the idle session: " << ip << std::endl;
+            auto session = FindSession(entry.id);
+            if (session)
+                session->Disconnect();
         } else {
-            outip = it->first;
-            it = _ping_remotes.erase(it);
-            std::cout << "Not receive client ping in 3 times: " << outip << std::endl;
-
-            if (_callbacks) {
-                _callbacks->onStateChanged(RPC_PINGOUT, outip);
-            }
+            std::cout << "Not receive client ping in " << PING_TIMEOUT << "s: " << ip << std::endl;
+            if (_callbacks)
+                _callbacks->onStateChanged(RPC_PINGOUT, ip);
         }
     }
 
-    if (recheck) {
-        _ping_timer->Setup(CppCommon::Timespan::seconds(HEARTBEAT_INTERVAL));
-        _ping_timer->WaitAsync();
+    if (_wheel.empty()) {
+        _wheel_ticking = false;
+        // a deadline may be added before stopped
+        if (!_wheel.empty())
+            startWheel();
+        return;
     }
+
+    _wheel_timer->Setup(CppCommon::Timespan::milliseconds(WHEEL_TICK_MS));
+    _wheel_timer->WaitAsync();
 }
 
 std::shared_ptr<CppServer::Asio::SSLSession>
@@ -179,23 +248,21 @@ ProtoServer::CreateSession(const std::shared_ptr<CppServer::Asio::SSLServer> &se
 {
     // data and state handle callback
     MessageHandler msg_cb([this](const proto::OriginMessage &request, proto::OriginMessage *response) {
-        // rpc from server, notify the response to request.get()
-        if (_self_request.load(std::memory_order_relaxed)) {
-            _self_request.store(false, std::memory_order_relaxed);
-            FinalClient::onReceiveResponse(request);
+        // the reply of the request from server
+        if (completeRequest(request))
             return;
-        }
 
         _callbacks->onReceivedMessage(request, response);
     });
 
-    NotifyHandler nft_cb([this](const std::string &addr) {
-        handlePing(addr);
+    NotifyHandler nft_cb([this](const std::string &addr, const std::string &notify) {
+        handlePing(addr, notify);
     });
 
     auto session = std::make_shared<ProtoSession>(server);
     session->setMessageHandler(msg_cb);
     session->setNotifyHandler(nft_cb);
+    session->setServer(this);
 
     return session;
 }
@@ -212,8 +279,12 @@ void ProtoServer::onConnected(std::shared_ptr<CppServer::Asio::SSLSession>& sess
 {
     // std::cout << "onConnected from:" << session->socket().remote_endpoint() << std::endl;
     std::string addr = session->socket().remote_endpoint().address().to_string();
-    std::shared_lock<std::shared_mutex> locker(_sessionids_lock);
-    _session_ids.insert(std::make_pair(addr, session->id()));
+    std::static_pointer_cast<ProtoSession>(session)->setRemote(addr);
+    _registry.add(addr, session->id());
+
+    // close it if it never pings
+    _wheel.schedule(addr, std::chrono::seconds(SESSION_IDLE_TIMEOUT));
+    startWheel();
 
     _callbacks->onStateChanged(RPC_CONNECTED, addr);
 }
@@ -222,22 +293,22 @@ void ProtoServer::onDisconnected(std::shared_ptr<CppServer::Asio::SSLSession>& s
 {
     //std::cout << "onDisconnected from: id: " << session->id() << std::endl;
 
-    auto search_uuid = session->id();
-    auto it = std::find_if(_session_ids.begin(), _session_ids.end(), [search_uuid](const std::pair<std::string, CppCommon::UUID>& pair) {
-        return pair.second == search_uuid;
-    });
-
-    std::string addr = "";
-    if (it != _session_ids.end()) {
-        //std::cout << "find connected by uuid, ip：" << it->first << std::endl;
-        addr = it->first;
-        _session_ids.erase(it);
-    } else {
-        std::cout << "did not find connected id:" << search_uuid << std::endl;
+    std::string addr = std::static_pointer_cast<ProtoSession>(session)->remote();
+    SessionRegistry::Entry entry;
+    bool warm = _registry.find(addr, &entry) && entry.id == session->id() && entry.warm;
+    if (!_registry.remove(addr, session->id())) {
+        // replaced by the new session of the same remote
+        std::cout << "did not find connected id:" << session->id() << std::endl;
         return;
     }
+    _wheel.cancel(addr);
+
+    // no reply will come for the pending calls to it
+    failRequests(addr);
 
-    _callbacks->onStateChanged(RPC_DISCONNECTED, addr);
+    // the parked one has been disconnected for the apps
+    if (!warm)
+        _callbacks->onStateChanged(RPC_DISCONNECTED, addr);
 }
 
 // Protocol implementation
@@ -250,11 +321,11 @@ size_t ProtoServer::onSend(const void *data, size_t size)
         return size;
     }
 
-    std::shared_lock<std::shared_mutex> locker(_sessionids_lock);
-    // std::cout << "FindSession:" << _session_ids[_active_traget] << std::endl;
-    auto session = FindSession(_session_ids[_active_traget]);
-    if (session) {
-        session->SendAsync(data, size);
+    SessionRegistry::Entry entry;
+    if (_registry.find(_active_traget, &entry)) {
+        auto session = FindSession(entry.id);
+        if (session)
+            session->SendAsync(data, size);
     }
 
     _active_traget = "";
@@ -8,15 +8,32 @@
 #include "asioservice.h"
 #include "protoendpoint.h"
 
+#include "sessionregistry.h"
+#include "timerwheel.h"
+
 #include "server/asio/ssl_server.h"
 
+// the ms of a tick of the timer wheel
+#define WHEEL_TICK_MS 500
+// the seconds without ping to mark the remote ping out
+#define PING_TIMEOUT (HEARTBEAT_INTERVAL * 3)
+// the seconds to close a session which never pings
+#define SESSION_IDLE_TIMEOUT 60
+
+class ProtoSession;
+
 class ProtoServer : public CppServer::Asio::SSLServer, public ProtoEndpoint
 {
+    // the sessions handle the typed messages by the server
+    friend class ProtoSession;
+
 public:
     using CppServer::Asio::SSLServer::SSLServer;
 
     bool hasConnected(const std::string &ip) override;
 
+    bool typedSupported(const std::string &ip) override;
+
 protected:
     std::shared_ptr<CppServer::Asio::SSLSession> CreateSession(const std::shared_ptr<CppServer::Asio::SSLServer> &server) override;
 
@@ -31,21 +48,21 @@ protected:
     size_t onSend(const void *data, size_t size) override;
 
 private:
-    bool startHeartbeat();
+    void startWheel();
 
-    void handlePing(const std::string &remote);
+    void handlePing(const std::string &remote, const std::string &notify);
 
-    void onHeartbeatTimeout(bool canceled);
+    void onWheelTick(bool canceled);
 
 private:
-    // <ip, sessionid>
-    std::shared_mutex _sessionids_lock;
-    std::map<std::string, CppCommon::UUID> _session_ids;
-
-    // heartbeat: ping <-> pong
-    std::shared_ptr<Timer> _ping_timer { nullptr };
-    // <ip, pinged>
-    std::map<std::string, std::atomic<int>> _ping_remotes;
+    // <ip, session>
+    SessionRegistry _registry;
+
+    // the deadlines of the ping and the idle sessions by ip
+    TimerWheel _wheel { std::chrono::milliseconds(WHEEL_TICK_MS) };
+    // ticks only while there is any deadline
+    std::shared_ptr<Timer> _wheel_timer { nullptr };
+    std::atomic<bool> _wheel_ticking { false };
 };
 
 #endif // PROTOSERVER_H
@@ -22,6 +22,12 @@ class SessionCallInterface : public std::enable_shared_from_this<SessionCallInte
 public:
     virtual void onReceivedMessage(const proto::OriginMessage &request, proto::OriginMessage *response) = 0;
 
+    // the typed messages, return false if not handled and the request will be rejected
+    virtual bool onReceivedMessage(const proto::LoginData &request, proto::LoginData *response) { return false; }
+    virtual bool onReceivedMessage(const proto::ApplyData &request, proto::ApplyData *response) { return false; }
+    virtual bool onReceivedMessage(const proto::TransData &request, proto::TransData *response) { return false; }
+    virtual bool onReceivedMessage(const proto::CancelData &request, proto::CancelData *response) { return false; }
+
     virtual bool onStateChanged(int state, std::string &msg) = 0;
 };
 
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sessionregistry.h"
+
+#include <functional>
+#include <mutex>
+
+void SessionRegistry::add(const std::string &ip, const CppCommon::UUID &id)
+{
+    auto &s = shard(ip);
+    std::unique_lock<std::shared_mutex> locker(s.lock);
+    Entry entry;
+    entry.id = id;
+    s.sessions[ip] = entry;
+}
+
+bool SessionRegistry::remove(const std::string &ip, const CppCommon::UUID &id)
+{
+    auto &s = shard(ip);
+    std::unique_lock<std::shared_mutex> locker(s.lock);
+    auto it = s.sessions.find(ip);
+    if (it == s.sessions.end() || it->second.id != id)
+        return false;
+    s.sessions.erase(it);
+    return true;
+}
+
+bool SessionRegistry::contains(const std::string &ip) const
+{
+    auto &s = shard(ip);
+    std::shared_lock<std::shared_mutex> locker(s.lock);
+    return s.sessions.find(ip) != s.sessions.end();
+}
+
+bool SessionRegistry::find(const std::string &ip, Entry *entry) const
+{
+    auto &s = shard(ip);
+    std::shared_lock<std::shared_mutex> locker(s.lock);
+    auto it = s.sessions.find(ip);
+    if (it == s.sessions.end())
+        return false;
+    *entry = it->second;
+    return true;
+}
+
+bool SessionRegistry::markPinged(const std::string &ip, bool typed, bool warm, bool *warmChanged)
+{
+    auto &s = shard(ip);
+    std::unique_lock<std::shared_mutex> locker(s.lock);
+    auto it = s.sessions.find(ip);
+    if (it == s.sessions.end())
+        return false;
+    it->second.pinged = true;
+    it->second.typed = typed;
+    *warmChanged = it->second.warm != warm;
+    it->second.warm = warm;
+    return true;
+}
+
+SessionRegistry::Shard &SessionRegistry::shard(const std::string &ip)
+{
+    return _shards[std::hash<std::string>()(ip) % SHARDS];
+}
+
+const SessionRegistry::Shard &SessionRegistry::shard(const std::string &ip) const
+{
+    return _shards[std::hash<std::string>()(ip) % SHARDS];
+}
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef SESSIONREGISTRY_H
+#define SESSIONREGISTRY_H
+
+#include "system/uuid.h"
+
+#include <array>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+// The connected sessions by the remote ip. The table is split into shards with their own locks,
+// the lookups of the sends and pings from different remotes do not block each other.
+class SessionRegistry
+{
+public:
+    struct Entry {
+        CppCommon::UUID id;
+        // the remote has sent ping
+        bool pinged { false };
+        // the remote handles the typed messages
+        bool typed { false };
+        // the remote parks the session, it is not connected for the apps
+        bool warm { false };
+    };
+
+    // add or replace the session of the ip, the last connected one is used
+    void add(const std::string &ip, const CppCommon::UUID &id);
+    // remove the ip if it is still the session, return false if replaced or not found
+    bool remove(const std::string &ip, const CppCommon::UUID &id);
+
+    bool contains(const std::string &ip) const;
+    bool find(const std::string &ip, Entry *entry) const;
+
+    // mark the ip pinged, return false if not connected. The warm one is changed by the ping,
+    // warmChanged tells whether it is.
+    bool markPinged(const std::string &ip, bool typed, bool warm, bool *warmChanged);
+
+private:
+    static constexpr size_t SHARDS = 16;
+
+    struct Shard {
+        mutable std::shared_mutex lock;
+        std::unordered_map<std::string, Entry> sessions;
+    };
+
+    Shard &shard(const std::string &ip);
+    const Shard &shard(const std::string &ip) const;
+
+    std::array<Shard, SHARDS> _shards;
+};
+
+#endif // SESSIONREGISTRY_H
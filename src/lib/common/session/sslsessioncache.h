@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef SSLSESSIONCACHE_H
+#define SSLSESSIONCACHE_H
+
+#include <openssl/ssl.h>
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// the remotes whose TLS sessions are kept
+#define MAX_CACHED_SESSIONS 32
+
+// The TLS sessions of the client connections by "address:port". The client context saves the
+// session (TLS 1.3 ticket) of each connection, the next connection to the same remote resumes it
+// and skips the certificate exchange of a full handshake.
+class SSLSessionCache
+{
+public:
+    static SSLSessionCache *instance()
+    {
+        static SSLSessionCache ins;
+        return &ins;
+    }
+
+    // save the sessions of the connections made by the client context
+    static void enable(SSL_CTX *ctx)
+    {
+        SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+        SSL_CTX_sess_set_new_cb(ctx, &SSLSessionCache::onNewSession);
+    }
+
+    // call before the handshake, resume the last session to the remote if any
+    void resume(SSL *ssl, const std::string &address, int port)
+    {
+        std::string peer = address + ":" + std::to_string(port);
+
+        // mark the connection, its new sessions are saved for the remote
+        delete static_cast<std::string *>(SSL_get_ex_data(ssl, peerIndex()));
+        SSL_set_ex_data(ssl, peerIndex(), new std::string(peer));
+
+        std::scoped_lock locker(_lock);
+        auto it = _sessions.find(peer);
+        if (it == _sessions.end())
+            return;
+        if (SSL_SESSION_is_resumable(it->second.session))
+            SSL_set_session(ssl, it->second.session);
+        else
+            erase(it);
+    }
+
+    // forget the remote, e.g. its certificate changed
+    void remove(const std::string &address, int port)
+    {
+        std::scoped_lock locker(_lock);
+        auto it = _sessions.find(address + ":" + std::to_string(port));
+        if (it != _sessions.end())
+            erase(it);
+    }
+
+private:
+    struct Cached {
+        SSL_SESSION *session { nullptr };
+        std::list<std::string>::iterator pos;
+    };
+
+    SSLSessionCache() = default;
+    ~SSLSessionCache()
+    {
+        for (auto &it : _sessions)
+            SSL_SESSION_free(it.second.session);
+    }
+
+    static int peerIndex()
+    {
+        static int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, &SSLSessionCache::freePeer);
+        return index;
+    }
+
+    static void freePeer(void *parent, void *ptr, CRYPTO_EX_DATA *ad, int idx, long argl, void *argp)
+    {
+        delete static_cast<std::string *>(ptr);
+    }
+
+    static int onNewSession(SSL *ssl, SSL_SESSION *session)
+    {
+        auto peer = static_cast<std::string *>(SSL_get_ex_data(ssl, peerIndex()));
+        if (!peer)
+            return 0;
+        // keep a copy, the session of a connection is made not resumable if it is closed without
+        // the TLS shutdown, e.g. the remote goes away
+        SSL_SESSION *copy = SSL_SESSION_dup(session);
+        if (copy)
+            instance()->save(*peer, copy);
+        return 0;
+    }
+
+    void save(const std::string &peer, SSL_SESSION *session)
+    {
+        std::scoped_lock locker(_lock);
+        auto it = _sessions.find(peer);
+        if (it != _sessions.end())
+            erase(it);
+
+        // drop the least recently connected one
+        if (_sessions.size() >= MAX_CACHED_SESSIONS)
+            erase(_sessions.find(_order.front()));
+
+        Cached cached;
+        cached.session = session;
+        cached.pos = _order.insert(_order.end(), peer);
+        _sessions.emplace(peer, cached);
+    }
+
+    void erase(std::unordered_map<std::string, Cached>::iterator it)
+    {
+        SSL_SESSION_free(it->second.session);
+        _order.erase(it->second.pos);
+        _sessions.erase(it);
+    }
+
+    std::mutex _lock;
+    std::unordered_map<std::string, Cached> _sessions;
+    // the peers by the time they are saved
+    std::list<std::string> _order;
+};
+
+#endif // SSLSESSIONCACHE_H
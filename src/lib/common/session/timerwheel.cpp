@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "timerwheel.h"
+
+#include <algorithm>
+
+TimerWheel::TimerWheel(std::chrono::milliseconds tick)
+    : _tick(tick)
+    , _start(std::chrono::steady_clock::now())
+{
+}
+
+void TimerWheel::schedule(const std::string &key, std::chrono::milliseconds timeout)
+{
+    auto now = std::chrono::steady_clock::now();
+    // round up, never expire earlier than the timeout
+    uint64_t deadline = static_cast<uint64_t>((now - _start + timeout + _tick - std::chrono::milliseconds(1)) / _tick);
+
+    std::scoped_lock locker(_lock);
+    // the wheel is not advanced while empty
+    if (_timers.empty())
+        _current = std::max(_current, static_cast<uint64_t>((now - _start) / _tick));
+
+    auto it = _timers.find(key);
+    if (it != _timers.end()) {
+        _slots[it->second.level][it->second.slot].erase(it->second.pos);
+    } else {
+        it = _timers.emplace(key, Timer()).first;
+    }
+    it->second.deadline = deadline;
+    place(key, it->second);
+}
+
+void TimerWheel::cancel(const std::string &key)
+{
+    std::scoped_lock locker(_lock);
+    auto it = _timers.find(key);
+    if (it == _timers.end())
+        return;
+    _slots[it->second.level][it->second.slot].erase(it->second.pos);
+    _timers.erase(it);
+}
+
+bool TimerWheel::empty()
+{
+    std::scoped_lock locker(_lock);
+    return _timers.empty();
+}
+
+std::vector<std::string> TimerWheel::expire(std::chrono::steady_clock::time_point now)
+{
+    std::vector<std::string> expired;
+    uint64_t target = static_cast<uint64_t>((now - _start) / _tick);
+
+    std::scoped_lock locker(_lock);
+    while (_current <= target && !_timers.empty()) {
+        uint64_t index = _current & (SLOTS - 1);
+        // the round of the lower level is over, bring down the timers of the upper slot
+        for (int level = 1; index == 0 && level < LEVELS; ++level) {
+            index = (_current >> (SLOT_BITS * level)) & (SLOTS - 1);
+            cascade(level, index);
+        }
+
+        auto &slot = _slots[0][_current & (SLOTS - 1)];
+        while (!slot.empty()) {
+            std::string key = std::move(slot.front());
+            slot.pop_front();
+            auto it = _timers.find(key);
+            if (it->second.deadline > _current) {
+                // it was beyond the top level
+                place(it->first, it->second);
+                continue;
+            }
+            _timers.erase(it);
+            expired.push_back(std::move(key));
+        }
+        _current++;
+    }
+    // nothing to visit, jump to now
+    if (_timers.empty())
+        _current = std::max(_current, target + 1);
+
+    return expired;
+}
+
+void TimerWheel::place(const std::string &key, Timer &timer)
+{
+    uint64_t deadline = std::max(timer.deadline, _current);
+    uint64_t delta = deadline - _current;
+
+    int level = 0;
+    while (level < LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1))))
+        level++;
+    // the farthest ones wait in the top level and are placed again when they come down
+    uint64_t limit = (uint64_t(1) << (SLOT_BITS * LEVELS)) - 1;
+    if (delta > limit)
+        deadline = _current + limit;
+
+    timer.level = level;
+    timer.slot = (deadline >> (SLOT_BITS * level)) & (SLOTS - 1);
+    auto &slot = _slots[level][timer.slot];
+    timer.pos = slot.insert(slot.end(), key);
+}
+
+void TimerWheel::cascade(int level, uint64_t slot)
+{
+    std::list<std::string> keys;
+    keys.swap(_slots[level][slot]);
+    for (auto &key : keys) {
+        auto it = _timers.find(key);
+        place(it->first, it->second);
+    }
+}
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Hierarchical timer wheel of the keyed timeouts. Scheduling, moving and canceling a timer
+// are O(1), a tick only visits the timers due in its slot and cascades the upper levels
+// once per round of the level below.
+class TimerWheel
+{
+public:
+    explicit TimerWheel(std::chrono::milliseconds tick);
+
+    // add the timer of the key, or move it if exists
+    void schedule(const std::string &key, std::chrono::milliseconds timeout);
+    void cancel(const std::string &key);
+    bool empty();
+
+    // advance the wheel to now, return the keys out of their time
+    std::vector<std::string> expire(std::chrono::steady_clock::time_point now);
+
+private:
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr uint64_t SLOTS = 1 << SLOT_BITS;
+
+    struct Timer {
+        // in ticks
+        uint64_t deadline { 0 };
+        int level { 0 };
+        uint64_t slot { 0 };
+        std::list<std::string>::iterator pos;
+    };
+
+    void place(const std::string &key, Timer &timer);
+    void cascade(int level, uint64_t slot);
+
+    std::mutex _lock;
+    std::chrono::milliseconds _tick;
+    std::chrono::steady_clock::time_point _start;
+    // the next tick to process
+    uint64_t _current { 0 };
+
+    std::list<std::string> _slots[LEVELS][SLOTS];
+    std::unordered_map<std::string, Timer> _timers;
+};
+
+#endif // TIMERWHEEL_H
@@ -108,6 +108,7 @@ inline constexpr char TransferModeKey[] { "TransferMode" };
 inline constexpr char StoragePathKey[] { "StoragePath" };
 inline constexpr char ClipboardShareKey[] { "ClipboardShare" };
 inline constexpr char CooperationEnabled[] { "CooperationEnabled" };
+inline constexpr char IncrementalSyncKey[] { "IncrementalSync" };
 
 inline constexpr char CacheGroup[] { "Cache" };
 inline constexpr char TransHistoryKey[] { "TransHistory" };
@@ -17,6 +17,7 @@
 #include "helper/phonehelper.h"
 #endif
 #include "utils/cooperationutil.h"
+#include "configs/settings/configmanager.h"
 #ifdef ENABLE_COMPAT
 #include "compatwrapper.h"
 #endif
@@ -34,24 +35,24 @@ NetworkUtilPrivate::NetworkUtilPrivate(NetworkUtil *qq)
     LOG << "This is only transfer?" << onlyTransfer;
 
     sessionManager = new SessionManager(this);
+    // receive the same folders again in place, not as the renamed copies
+    auto incremental = ConfigManager::instance()->appAttribute(AppSettings::GenericGroup, AppSettings::IncrementalSyncKey);
+    sessionManager->setIncrementalSync(incremental.isValid() && incremental.toBool());
     if (onlyTransfer) {
         return;
     }
     servePort = COO_SESSION_PORT;
 
-    ExtenMessageHandler msg_cb([this](int32_t mask, const picojson::value &json_value, std::string *res_msg) -> bool {
+    ExtenApplyHandler apply_cb([this](int32_t mask, const ApplyMessage &req, ApplyMessage *res) -> bool {
 #ifdef QT_DEBUG
-        DLOG << "NetworkUtil >> " << mask << " msg_cb, json_msg: " << json_value << std::endl;
+        DLOG << "NetworkUtil >> " << mask << " apply_cb, nick: " << req.nick << " host: " << req.host << std::endl;
 #endif
         switch (mask) {
         case APPLY_INFO: {
-            ApplyMessage req, res;
-            req.from_json(json_value);
-            res.flag = DO_DONE;
-            WLOG << "msg_cb: " << json_value;
+            res->flag = DO_DONE;
+            WLOG << "apply_cb: " << req.nick;
             // response my device info.
-            res.nick = q->deviceInfoStr().toStdString();
-            *res_msg = res.as_json().serialize();
+            res->nick = q->deviceInfoStr().toStdString();
 
             // update this device info to discovery list
             q->metaObject()->invokeMethod(DiscoverController::instance(),
@@ -61,10 +62,7 @@ NetworkUtilPrivate::NetworkUtilPrivate(NetworkUtil *qq)
         }
             return true;
         case APPLY_TRANS: {
-            ApplyMessage req, res;
-            req.from_json(json_value);
-            res.flag = DO_WAIT;
-            *res_msg = res.as_json().serialize();
+            res->flag = DO_WAIT;
             confirmTargetAddress = QString::fromStdString(req.host);
 
             q->metaObject()->invokeMethod(TransferHelper::instance(),
@@ -75,22 +73,16 @@ NetworkUtilPrivate::NetworkUtilPrivate(NetworkUtil *qq)
         }
             return true;
         case APPLY_TRANS_RESULT: {
-            ApplyMessage req, res;
-            req.from_json(json_value);
             bool agree = (req.flag == REPLY_ACCEPT);
-            res.flag = DO_DONE;
-            *res_msg = res.as_json().serialize();
+            res->flag = DO_DONE;
             q->metaObject()->invokeMethod(TransferHelper::instance(),
                                           agree ? "accepted" : "rejected",
                                           Qt::QueuedConnection);
         }
             return true;
         case APPLY_SHARE: {
-            ApplyMessage req, res;
-            req.from_json(json_value);
-            res.flag = DO_WAIT;
+            res->flag = DO_WAIT;
             QString info = QString::fromStdString(req.host + "," + req.nick + "," + req.fingerprint);
-            *res_msg = res.as_json().serialize();
             confirmTargetAddress = QString::fromStdString(req.host);
             q->metaObject()->invokeMethod(ShareHelper::instance(),
                                           "notifyConnectRequest",
@@ -99,11 +91,8 @@ NetworkUtilPrivate::NetworkUtilPrivate(NetworkUtil *qq)
         }
             return true;
         case APPLY_SHARE_RESULT: {
-            ApplyMessage req, res;
-            req.from_json(json_value);
             bool agree = (req.flag == REPLY_ACCEPT);
-            res.flag = DO_DONE;
-            *res_msg = res.as_json().serialize();
+            res->flag = DO_DONE;
             q->metaObject()->invokeMethod(ShareHelper::instance(),
                                           "handleConnectResult",
                                           Qt::QueuedConnection,
@@ -112,10 +101,7 @@ NetworkUtilPrivate::NetworkUtilPrivate(NetworkUtil *qq)
         }
             return true;
         case APPLY_SHARE_STOP: {
-            ApplyMessage req, res;
-            req.from_json(json_value);
-            res.flag = DO_DONE;
-            *res_msg = res.as_json().serialize();
+            res->flag = DO_DONE;
             q->metaObject()->invokeMethod(ShareHelper::instance(),
                                           "handleDisConnectResult",
                                           Qt::QueuedConnection,
@@ -123,10 +109,7 @@ NetworkUtilPrivate::NetworkUtilPrivate(NetworkUtil *qq)
         }
             return true;
         case APPLY_CANCELED: {
-            ApplyMessage req, res;
-            req.from_json(json_value);
-            res.flag = DO_DONE;
-            *res_msg = res.as_json().serialize();
+            res->flag = DO_DONE;
             if (req.nick == "share") {
                 q->metaObject()->invokeMethod(ShareHelper::instance(),
                                               "handleCancelCooperApply",
@@ -140,10 +123,8 @@ NetworkUtilPrivate::NetworkUtilPrivate(NetworkUtil *qq)
             return true;
 #ifdef ENABLE_PHONE
         case APPLY_SCAN_CONNECT: {
-            ApplyMessage req, res;
-            req.from_json(json_value);
-            res.flag = DO_DONE;
-            res.nick = q->deviceInfoStr().toStdString();
+            res->flag = DO_DONE;
+            res->nick = q->deviceInfoStr().toStdString();
 
             QString ipAddress = req.host.c_str();
             QString deviceName = req.nick.c_str();
@@ -159,7 +140,6 @@ NetworkUtilPrivate::NetworkUtilPrivate(NetworkUtil *qq)
                     height = resolutionParts[1].toInt(); // Height
                 }
             }
-            *res_msg = res.as_json().serialize();
 
             DeviceInfoPointer info(new DeviceInfo(ipAddress, deviceName));
             info->setConnectStatus(DeviceInfo::ConnectStatus::Connected);
@@ -172,20 +152,14 @@ NetworkUtilPrivate::NetworkUtilPrivate(NetworkUtil *qq)
         }
             return true;
         case APPLY_PROJECTION: {
-            ApplyMessage req, res;
-            req.from_json(json_value);
-            res.flag = DO_WAIT;
-            *res_msg = res.as_json().serialize();
+            res->flag = DO_WAIT;
             q->metaObject()->invokeMethod(PhoneHelper::instance(),
                                           "onScreenMirroring",
                                           Qt::QueuedConnection);
         }
             return true;
         case APPLY_PROJECTION_STOP: {
-            ApplyMessage req, res;
-            req.from_json(json_value);
-            res.flag = DO_DONE;
-            *res_msg = res.as_json().serialize();
+            res->flag = DO_DONE;
             q->metaObject()->invokeMethod(PhoneHelper::instance(), "onScreenMirroringStop",
                                           Qt::QueuedConnection);
         }
@@ -197,7 +171,7 @@ NetworkUtilPrivate::NetworkUtilPrivate(NetworkUtil *qq)
         return false;
     });
 
-    sessionManager->setSessionExtCallback(msg_cb);
+    sessionManager->setSessionApplyCallback(apply_cb);
     sessionManager->updatePin(COO_HARD_PIN);
     sessionManager->sessionListen(servePort);
 
@@ -518,8 +492,7 @@ void NetworkUtil::reqTargetInfo(const QString &ip, bool compat)
         msg.flag = ASK_QUIET;
         msg.host = ip.toStdString();
         msg.nick = deviceInfoStr().toStdString();
-        QString jsonMsg = msg.as_json().serialize().c_str();
-        d->sessionManager->sendRpcRequest(ip, APPLY_INFO, jsonMsg);
+        d->sessionManager->sendRpcRequest(ip, APPLY_INFO, msg);
         // handle callback result in handleAsyncRpcResult
     }
 }
@@ -605,8 +578,7 @@ void NetworkUtil::sendTransApply(const QString &ip, bool compat)
         msg.flag = ASK_NEEDCONFIRM;
         msg.nick = deviceName.toStdString();   // user define nice name
         msg.host = CooperationUtil::localIPAddress().toStdString();
-        QString jsonMsg = msg.as_json().serialize().c_str();
-        d->sessionManager->sendRpcRequest(ip, APPLY_TRANS, jsonMsg);
+        d->sessionManager->sendRpcRequest(ip, APPLY_TRANS, msg);
     }
 }
 
@@ -650,8 +622,7 @@ void NetworkUtil::sendShareApply(const QString &ip, bool compat)
         msg.nick = selfinfo->deviceName().toStdString();
         msg.host = CooperationUtil::localIPAddress().toStdString();
         msg.fingerprint = _selfFingerPrint.toStdString();   // send self fingerprint
-        QString jsonMsg = msg.as_json().serialize().c_str();
-        d->sessionManager->sendRpcRequest(ip, APPLY_SHARE, jsonMsg);
+        d->sessionManager->sendRpcRequest(ip, APPLY_SHARE, msg);
     }
 }
 
@@ -664,8 +635,7 @@ void NetworkUtil::sendDisconnectShareEvents(const QString &ip)
         msg.flag = ASK_NEEDCONFIRM;
         msg.nick = selfinfo->deviceName().toStdString();
         msg.host = CooperationUtil::localIPAddress().toStdString();
-        QString jsonMsg = msg.as_json().serialize().c_str();
-        d->sessionManager->sendRpcRequest(ip, APPLY_SHARE_STOP, jsonMsg);
+        d->sessionManager->sendRpcRequest(ip, APPLY_SHARE_STOP, msg);
     } else {
 #ifdef ENABLE_COMPAT
         // try again with old protocol by daemon
@@ -682,10 +652,9 @@ void NetworkUtil::replyTransRequest(bool agree)
         ApplyMessage msg;
         msg.flag = agree ? REPLY_ACCEPT : REPLY_REJECT;
         msg.host = CooperationUtil::localIPAddress().toStdString();
-        QString jsonMsg = msg.as_json().serialize().c_str();
 
         // _confirmTargetAddress
-        d->sessionManager->sendRpcRequest(d->confirmTargetAddress, APPLY_TRANS_RESULT, jsonMsg);
+        d->sessionManager->sendRpcRequest(d->confirmTargetAddress, APPLY_TRANS_RESULT, msg);
 
         d->sessionManager->updateSaveFolder(d->storageFolder);
     } else {
@@ -707,10 +676,9 @@ void NetworkUtil::replyShareRequest(bool agree, const QString &selfprint)
         msg.flag = agree ? REPLY_ACCEPT : REPLY_REJECT;
         msg.host = CooperationUtil::localIPAddress().toStdString();
         msg.fingerprint = selfprint.toStdString();   // send self fingerprint
-        QString jsonMsg = msg.as_json().serialize().c_str();
 
         // _confirmTargetAddress
-        d->sessionManager->sendRpcRequest(d->confirmTargetAddress, APPLY_SHARE_RESULT, jsonMsg);
+        d->sessionManager->sendRpcRequest(d->confirmTargetAddress, APPLY_SHARE_RESULT, msg);
     } else {
 #ifdef ENABLE_COMPAT
         int reply = agree ? SHARE_CONNECT_COMFIRM : SHARE_CONNECT_REFUSE;
@@ -726,8 +694,7 @@ void NetworkUtil::cancelApply(const QString &type)
     if (!d->confirmTargetAddress.isEmpty()) {
         ApplyMessage msg;
         msg.nick = type.toStdString();
-        QString jsonMsg = msg.as_json().serialize().c_str();
-        d->sessionManager->sendRpcRequest(d->confirmTargetAddress, APPLY_CANCELED, jsonMsg);
+        d->sessionManager->sendRpcRequest(d->confirmTargetAddress, APPLY_CANCELED, msg);
     } else {
 #ifdef ENABLE_COMPAT
         // FIXME: cancel trans apply
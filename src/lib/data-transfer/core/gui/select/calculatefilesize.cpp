@@ -1,8 +1,8 @@
 #include "calculatefilesize.h"
 
 #include "common/log.h"
+#include "manager/dirsizeservice.h"
 
-#include <QThreadPool>
 #include <QListView>
 #include <QStandardItemModel>
 #include <QDebug>
@@ -63,46 +63,6 @@ quint64 fromQstringToByte(QString sizeString)
     return bytes;
 }
 
-CalculateFileSizeTask::CalculateFileSizeTask(QObject *pool, const QString &path)
-    : filePath(path), calculatePool(pool)
-{
-}
-
-CalculateFileSizeTask::~CalculateFileSizeTask() { }
-
-void CalculateFileSizeTask::run()
-{
-    fileSize = calculate(filePath);
-    QMetaObject::invokeMethod(calculatePool, "sendFileSizeSlots", Qt::QueuedConnection,
-                              Q_ARG(quint64, fileSize), Q_ARG(QString, filePath));
-}
-
-void CalculateFileSizeTask::abortTask()
-{
-    abort = true;
-}
-
-qlonglong CalculateFileSizeTask::calculate(const QString &path)
-{
-    if (abort) {
-        return 0;
-    }
-
-    QDir directory(path);
-    directory.setFilter(QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot);
-    QFileInfoList fileList = directory.entryInfoList();
-    qlonglong tempSize = 0;
-    for (const QFileInfo &fileInfo : fileList) {
-        if (fileInfo.isDir()) {
-            tempSize += calculate(fileInfo.absoluteFilePath());
-        } else {
-            tempSize += fileInfo.size();
-        }
-    }
-
-    return tempSize;
-}
-
 CalculateFileSizeThreadPool *CalculateFileSizeThreadPool::instance()
 {
     static CalculateFileSizeThreadPool ins;
@@ -113,9 +73,12 @@ CalculateFileSizeThreadPool::~CalculateFileSizeThreadPool() { }
 
 CalculateFileSizeThreadPool::CalculateFileSizeThreadPool()
 {
-    threadPool = new QThreadPool();
     fileMap = new QMap<QString, FileInfo>();
-    threadPool->setMaxThreadCount(4);
+    // 目录大小由共享的统计服务计算，重复选择时使用缓存
+    QObject::connect(DirSizeService::instance(), &DirSizeService::sizeFinished, this,
+                     [this](const QString path, quint64 totalSize) {
+                         sendFileSizeSlots(totalSize, path);
+                     }, Qt::QueuedConnection);
     // connect main thread exit signal
     QObject::connect(qApp, &QCoreApplication::aboutToQuit, this,
                      &CalculateFileSizeThreadPool::exitPool, Qt::DirectConnection);
@@ -128,9 +91,7 @@ void CalculateFileSizeThreadPool::work(const QList<QString> &list)
         if (fileInfo.isFile()) {
             continue;
         } else if (fileInfo.isDir()) {
-            CalculateFileSizeTask *task = new CalculateFileSizeTask(this, path);
-            workList.push_back(task);
-            threadPool->start(task);
+            DirSizeService::instance()->calculate(path);
         } else {
             WLOG << "Path is neither a file nor a directory:" << path.toStdString();
         }
@@ -170,13 +131,9 @@ void CalculateFileSizeThreadPool::addFileSlots(const QList<QString> &list)
 
 void CalculateFileSizeThreadPool::exitPool()
 {
-    threadPool->clear();
-    for (CalculateFileSizeTask *task : workList) {
-        task->abortTask();
-    }
-    threadPool->waitForDone();
+    QObject::disconnect(DirSizeService::instance(), nullptr, this, nullptr);
+    DirSizeService::instance()->cancelAll();
     LOG << "calculate file size exit.";
-    delete threadPool;
     delete fileMap;
 }
 
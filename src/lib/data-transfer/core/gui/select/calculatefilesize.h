@@ -3,11 +3,9 @@
 
 #include <QModelIndex>
 #include <QObject>
-#include <QRunnable>
 #include <QThread>
 
 class QListView;
-class QThreadPool;
 class QTimer;
 class QStandardItem;
 class QMutex;
@@ -23,22 +21,6 @@ struct FileInfo
 QString fromByteToQstring(quint64 bytes);
 quint64 fromQstringToByte(QString sizeString);
 
-class CalculateFileSizeTask : public QRunnable
-{
-public:
-    CalculateFileSizeTask(QObject *pool, const QString &path);
-    ~CalculateFileSizeTask() override;
-    void run() override;
-    void abortTask();
-
-private:
-    qlonglong calculate(const QString &path);
-    QString filePath;
-    qlonglong fileSize{ 0 };
-    QObject *calculatePool{ nullptr };
-    bool abort{ false };
-};
-
 class CalculateFileSizeThreadPool : public QObject
 {
     Q_OBJECT
@@ -63,8 +45,6 @@ signals:
 
 private:
     CalculateFileSizeThreadPool();
-    QThreadPool *threadPool;
-    QList<CalculateFileSizeTask *> workList;
 
 public:
     QMap<QString, FileInfo> *fileMap;